@@ -0,0 +1,126 @@
+// =============================================
+// EFIGUI Benchmark - Widget State Storage
+// Compares Animation's IdTable with std::unordered_map
+// =============================================
+// Each "frame" looks up every live id once (in a shuffled order, as a UI
+// tree would), then a prune pass removes states idle for more than a set
+// number of frames. Prints the average cost per frame for each container.
+
+#include "EFIGUI/Core/IdTable.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // Same layout as Animation::WidgetState
+    struct State
+    {
+        float hoverAnim = 0.0f;
+        float activeAnim = 0.0f;
+        float selectedAnim = 0.0f;
+        float glowPhase = 0.0f;
+        float clickAnim = 0.0f;
+        float slideAnim = 0.0f;
+        int lastUpdateFrame = 0;
+    };
+
+    constexpr int Frames = 60;
+    constexpr int MaxIdleFrames = 30;
+
+    using Clock = std::chrono::steady_clock;
+
+    double Milliseconds(Clock::duration d)
+    {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    struct Result
+    {
+        double lookupMs = 0.0;
+        double pruneMs = 0.0;
+    };
+
+    // Ids look like ImGui hashes; one in ten widgets disappears halfway through
+    std::vector<uint32_t> MakeIds(size_t count)
+    {
+        std::mt19937 rng(1234);
+        std::vector<uint32_t> ids(count);
+        for (auto& id : ids)
+            id = rng();
+        return ids;
+    }
+
+    template<typename LookupFn, typename PruneFn>
+    Result Run(const std::vector<uint32_t>& ids, LookupFn lookup, PruneFn prune)
+    {
+        Result result;
+        const size_t visible = ids.size() - ids.size() / 10;
+
+        for (int frame = 1; frame <= Frames; frame++)
+        {
+            size_t count = frame > Frames / 2 ? visible : ids.size();
+
+            auto start = Clock::now();
+            for (size_t i = 0; i < count; i++)
+            {
+                State& state = lookup(ids[i]);
+                state.hoverAnim += 0.1f;
+                state.lastUpdateFrame = frame;
+            }
+            auto mid = Clock::now();
+            prune(frame);
+            auto end = Clock::now();
+
+            result.lookupMs += Milliseconds(mid - start);
+            result.pruneMs += Milliseconds(end - mid);
+        }
+
+        result.lookupMs /= Frames;
+        result.pruneMs /= Frames;
+        return result;
+    }
+
+    void Benchmark(size_t count)
+    {
+        std::vector<uint32_t> ids = MakeIds(count);
+        std::shuffle(ids.begin(), ids.end(), std::mt19937(99));
+
+        std::unordered_map<uint32_t, State> map;
+        Result mapResult = Run(ids,
+            [&](uint32_t id) -> State& { return map[id]; },
+            [&](int frame) {
+                for (auto it = map.begin(); it != map.end();)
+                {
+                    if (frame - it->second.lastUpdateFrame > MaxIdleFrames)
+                        it = map.erase(it);
+                    else
+                        ++it;
+                }
+            });
+
+        EFIGUI::IdTable<State> table;
+        Result tableResult = Run(ids,
+            [&](uint32_t id) -> State& { return table.GetOrCreate(id); },
+            [&](int frame) {
+                table.RemoveIf([&](uint32_t, const State& state) {
+                    return frame - state.lastUpdateFrame > MaxIdleFrames;
+                });
+            });
+
+        printf("%8zu ids | unordered_map lookup %8.3f ms  prune %8.3f ms | IdTable lookup %8.3f ms  prune %8.3f ms\n",
+               count, mapResult.lookupMs, mapResult.pruneMs, tableResult.lookupMs, tableResult.pruneMs);
+    }
+}
+
+int main()
+{
+    printf("Average per frame over %d frames\n", Frames);
+    for (size_t count : { size_t(1000), size_t(10000), size_t(100000) })
+        Benchmark(count);
+    return 0;
+}
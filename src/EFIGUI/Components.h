@@ -618,7 +618,8 @@ namespace EFIGUI
     // layer: rendering layer for glow effects (omit = use LayerConfig default)
     bool NumericInput(const char* label, float* value, const NumericInputConfig& config, std::optional<Layer> layer = std::nullopt);
 
-    // Cleanup stale numeric input buffers (called automatically from BeginFrame)
+    // Cleanup stale numeric input buffers
+    // (BeginFrame already prunes them with the rest of the widget's state)
     void PruneNumericInputBuffers(int maxIdleFrames = 60);
 
     // =============================================
@@ -386,6 +386,7 @@ namespace EFIGUI
         if (isOnCooldown)
         {
             float sweepPos = Animation::Sweep(0.5f);
+            Animation::RequestRedraw();
             DrawCooldownOverlay(draw, pos, size, config.cooldownProgress, rounding, config.glowColor, sweepPos);
         }
 
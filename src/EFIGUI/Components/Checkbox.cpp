@@ -52,7 +52,7 @@ bool CheckboxEx(const char* label, bool* v, const CheckboxStyle& style) {
     // Draw glow (animate smoothly on both check and uncheck)
     if (state.selectedAnim > 0.01f) {
         Draw::RectGlow(check_bb.Min, check_bb.Max, style.glowColor,
-                       style.glowIntensity * state.selectedAnim, 4.0f);
+                       style.glowIntensity * state.selectedAnim, 4.0f, style.rounding);
     }
 
     // Draw checkmark
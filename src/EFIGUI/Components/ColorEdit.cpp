@@ -88,7 +88,7 @@ bool ColorButtonEx(const char* desc_id, const ImVec4& col, ImGuiColorEditFlags f
     // Draw glow on hover
     if (state.hoverAnim > 0.01f) {
         Draw::RectGlow(bb.Min, bb.Max, style.swatchGlowColor,
-                       style.glowIntensity * state.hoverAnim, 4.0f);
+                       style.glowIntensity * state.hoverAnim, 4.0f, style.swatchRounding);
     }
 
     return pressed;
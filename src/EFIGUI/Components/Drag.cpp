@@ -4,9 +4,9 @@
 #include "../Core/Draw.h"
 #include "../Core/Layer.h"
 #include "../Core/Style.h"
+#include "../Core/WidgetStore.h"
 #include "imgui_internal.h"
 #include <algorithm>
-#include <unordered_map>
 
 namespace EFIGUI {
 
@@ -21,36 +21,21 @@ struct DragValueState {
     float lastTimeUsed = 0.0f;  // Track last usage time
 };
 
-// Type alias for per-context drag state storage
-using DragValueStateMap = std::unordered_map<ImGuiID, DragValueState>;
-
-static DragValueStateMap& GetDragValueStates() {
-    // Use StyleSystem's per-context storage instead of global static
-    // This ensures proper isolation in multi-context scenarios
-    return StyleSystem::GetComponentState<DragValueStateMap>();
-}
+// Drag states are a WidgetStore side table, so they share the widget's entry
+// (and its per-context ownership and pruning) with the animation state
 
 void PruneDragValueStates(float maxIdleSeconds) {
-    float currentTime = static_cast<float>(ImGui::GetTime());
-    auto& states = GetDragValueStates();
-
-    for (auto it = states.begin(); it != states.end(); ) {
-        if (currentTime - it->second.lastTimeUsed > maxIdleSeconds) {
-            it = states.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    float currentTime = Animation::GetTime();
+    GetWidgetStore().DetachSideIf<DragValueState>([&](const WidgetEntry&, const DragValueState& state) {
+        return currentTime - state.lastTimeUsed > maxIdleSeconds;
+    });
 }
 
-static float GetChangeFeedbackAnim(ImGuiID id, float currentValue, float feedbackDuration) {
-    auto& states = GetDragValueStates();
-    auto& state = states[id];
-
-    // Track when this state was last used for GC purposes
-    state.lastTimeUsed = static_cast<float>(ImGui::GetTime());
+static float GetChangeFeedbackAnim(DragValueState& state, float currentValue, float feedbackDuration) {
+    // Track when this state was last used for PruneDragValueStates
+    state.lastTimeUsed = Animation::GetTime();
 
-    float dt = ImGui::GetIO().DeltaTime;
+    float dt = Animation::GetDeltaTime();
 
     // Check if value changed
     if (currentValue != state.lastValue) {
@@ -112,8 +97,10 @@ bool DragFloatEx(const char* label, float* v, float v_speed,
     ImGuiContext& g = *GImGui;
     const ImGuiID id = window->GetID(label);
 
-    // Get animation states
-    Animation::WidgetState& animState = Animation::GetState(id);
+    // One store lookup for the animation and change-feedback state
+    WidgetStore& store = GetWidgetStore();
+    WidgetEntry& entry = store.Get(id);
+    Animation::WidgetState& animState = entry.anim;
 
     // Push style colors
     ImGui::PushStyleColor(ImGuiCol_FrameBg, style.frameColor);
@@ -152,7 +139,7 @@ bool DragFloatEx(const char* label, float* v, float v_speed,
     }
 
     // Draw value change feedback glow
-    float changeFeedback = GetChangeFeedbackAnim(id, *v, style.changeFeedbackDuration);
+    float changeFeedback = GetChangeFeedbackAnim(store.GetSide<DragValueState>(entry), *v, style.changeFeedbackDuration);
     if (changeFeedback > 0.01f && changed) {
         Draw::RectGlow(itemRect.Min, itemRect.Max, style.changeGlowColor,
                        style.glowIntensity * changeFeedback, 5.0f);
@@ -271,8 +258,10 @@ bool DragIntEx(const char* label, int* v, float v_speed,
     ImGuiContext& g = *GImGui;
     const ImGuiID id = window->GetID(label);
 
-    // Get animation states
-    Animation::WidgetState& animState = Animation::GetState(id);
+    // One store lookup for the animation and change-feedback state
+    WidgetStore& store = GetWidgetStore();
+    WidgetEntry& entry = store.Get(id);
+    Animation::WidgetState& animState = entry.anim;
 
     // Push style colors
     ImGui::PushStyleColor(ImGuiCol_FrameBg, style.frameColor);
@@ -311,7 +300,7 @@ bool DragIntEx(const char* label, int* v, float v_speed,
     }
 
     // Draw value change feedback glow
-    float changeFeedback = GetChangeFeedbackAnim(id, static_cast<float>(*v), style.changeFeedbackDuration);
+    float changeFeedback = GetChangeFeedbackAnim(store.GetSide<DragValueState>(entry), static_cast<float>(*v), style.changeFeedbackDuration);
     if (changeFeedback > 0.01f && changed) {
         Draw::RectGlow(itemRect.Min, itemRect.Max, style.changeGlowColor,
                        style.glowIntensity * changeFeedback, 5.0f);
@@ -88,6 +88,8 @@ bool DragIntRange2(const char* label, int* v_current_min, int* v_current_max,
 // =============================================
 
 /// Prune stale drag value states that haven't been used recently.
+/// BeginFrame already prunes them with the rest of the widget's state
+/// (after 60 idle frames); this adds a time-based cutoff.
 /// @param maxIdleSeconds States unused for this duration will be removed (default: 2.0s)
 void PruneDragValueStates(float maxIdleSeconds = 2.0f);
 
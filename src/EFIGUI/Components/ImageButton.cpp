@@ -55,7 +55,7 @@ bool ImageButtonEx(const char* str_id, ImTextureID user_texture_id,
     // Draw glow on hover
     if (style.showGlow && animState.hoverAnim > 0.01f) {
         Draw::RectGlow(bb.Min, bb.Max, style.glowColor,
-                       style.glowIntensity * animState.hoverAnim, 4.0f);
+                       style.glowIntensity * animState.hoverAnim, 4.0f, style.rounding);
     }
 
     // Calculate image position (centered with padding)
@@ -12,6 +12,7 @@
 #include "../Components.h"
 #include "../Core/Draw.h"
 #include "../Core/EFIGUI.h"
+#include "../Core/WidgetStore.h"
 #include "imgui_internal.h"
 #include <algorithm>
 #include <cmath>
@@ -44,6 +45,6 @@ namespace EFIGUI
     // Component Cleanup Functions
     // =============================================
 
-    // Prune stale slider input buffers (called from BeginFrame)
+    // Prune stale slider input buffers (BeginFrame prunes them with the widget's state)
     void PruneSliderInputBuffers(int maxIdleFrames = 60);
 }
@@ -1,9 +1,9 @@
 // src/EFIGUI/Components/ListBox.cpp
 #include "ListBox.h"
 #include "../Core/Animation.h"
+#include "../Core/EFIGUI.h"
 #include "../Core/Style.h"
 #include "imgui_internal.h"
-#include <vector>
 
 namespace EFIGUI {
 
@@ -132,12 +132,12 @@ bool ListBox(const char* label, int* current_item, const char* const items[],
 bool ListBox(const char* label, int* current_item,
              const char* (*getter)(void* user_data, int idx),
              void* user_data, int items_count, int height_in_items) {
-    // Build items array from getter using std::vector (safe, portable)
-    std::vector<const char*> items(items_count);
+    // Build items array from getter in the frame arena (no per-frame heap allocation)
+    const char** items = GetFrameArena().AllocateArray<const char*>(items_count > 0 ? items_count : 1);
     for (int i = 0; i < items_count; ++i) {
         items[i] = getter(user_data, i);
     }
-    return ListBox(label, current_item, items.data(), items_count, height_in_items);
+    return ListBox(label, current_item, items, items_count, height_in_items);
 }
 
 } // namespace EFIGUI
@@ -89,7 +89,8 @@ namespace EFIGUI
                 ImVec2(pos.x + accentBarWidth, barY + barHeight),
                 effectiveAccentGlow,
                 state.selectedAnim,
-                accentBarGlowRadius
+                accentBarGlowRadius,
+                accentBarWidth * 0.5f
             );
         }
 
@@ -27,33 +27,24 @@ namespace EFIGUI
         int lastUpdateFrame = 0;
     };
 
-    static std::unordered_map<ImGuiID, NumericInputData>& GetNumericInputBuffers()
-    {
-        static std::unordered_map<ImGuiID, NumericInputData> s_buffers;
-        return s_buffers;
-    }
+    // Buffers are a WidgetStore side table attached to the input's entry
 
     // =============================================
     // NumericInput Helper Functions
     // =============================================
 
-    static std::string FormatNumericValue(float value, int precision)
+    // Formatted text lives in the frame arena (valid until the next BeginFrame)
+    static const char* FormatNumericValue(float value, int precision)
     {
-        std::ostringstream oss;
-        oss << std::fixed << std::setprecision(precision) << value;
-        return oss.str();
+        return GetFrameArena().Format("%.*f", precision, value);
     }
 
-    static bool ApplyNumericInputValue(ImGuiID id, float* value, float min, float max, int precision)
+    static bool ApplyNumericInputValue(NumericInputData& data, float* value, float min, float max, int precision)
     {
-        auto& buffers = GetNumericInputBuffers();
-        auto it = buffers.find(id);
-        if (it == buffers.end()) return false;
-
         bool changed = false;
         try
         {
-            float newVal = std::stof(it->second.buffer);
+            float newVal = std::stof(data.buffer);
             newVal = std::clamp(newVal, min, max);
             if (value && newVal != *value)
             {
@@ -64,31 +55,32 @@ namespace EFIGUI
         catch (...) { /* Invalid input, ignore */ }
 
         // Sync buffer back to current value
-        it->second.buffer = FormatNumericValue(value ? *value : 0.0f, precision);
-        it->second.lastUpdateFrame = ImGui::GetFrameCount();
+        data.buffer = FormatNumericValue(value ? *value : 0.0f, precision);
+        data.lastUpdateFrame = ImGui::GetFrameCount();
         return changed;
     }
 
-    static void SyncNumericInputBuffer(ImGuiID id, float value, int precision, bool isEditing)
+    static NumericInputData& SyncNumericInputBuffer(WidgetEntry& entry, float value, int precision, bool isEditing)
     {
-        auto& buffers = GetNumericInputBuffers();
-        std::string expectedValue = FormatNumericValue(value, precision);
+        WidgetStore& store = GetWidgetStore();
+        const char* expectedValue = FormatNumericValue(value, precision);
         int currentFrame = ImGui::GetFrameCount();
 
-        auto it = buffers.find(id);
-        if (it == buffers.end())
+        NumericInputData* data = store.FindSide<NumericInputData>(entry);
+        if (!data)
         {
-            buffers[id] = { expectedValue, currentFrame };
+            NumericInputData& created = store.GetSide<NumericInputData>(entry);
+            created = { expectedValue, currentFrame };
+            return created;
         }
-        else
+
+        data->lastUpdateFrame = currentFrame;
+        // Only sync if not editing (don't overwrite user input)
+        if (!isEditing && data->buffer != expectedValue)
         {
-            it->second.lastUpdateFrame = currentFrame;
-            // Only sync if not editing (don't overwrite user input)
-            if (!isEditing && it->second.buffer != expectedValue)
-            {
-                it->second.buffer = expectedValue;
-            }
+            data->buffer = expectedValue;
         }
+        return *data;
     }
 
     // =============================================
@@ -172,7 +164,6 @@ namespace EFIGUI
         if (!value) return false;
 
         ImGuiID id = ImGui::GetID(label);
-        auto& buffers = GetNumericInputBuffers();
 
         // Calculate box position and size
         ImVec2 pos = ImGui::GetCursorScreenPos();
@@ -184,15 +175,18 @@ namespace EFIGUI
         ImDrawList* draw = ImGui::GetWindowDrawList();
 
         // Build InputText ID to check if we're editing
-        std::string inputIdStr = std::string("##") + label + "_input";
-        ImGuiID inputTextId = ImGui::GetID(inputIdStr.c_str());
+        const char* inputIdStr = GetFrameArena().Format("##%s_input", label);
+        ImGuiID inputTextId = ImGui::GetID(inputIdStr);
         bool isEditing = (ImGui::GetActiveID() == inputTextId);
 
+        // One store lookup for the text buffer and the animation state
+        WidgetEntry& entry = GetWidgetStore().Get(id);
+
         // Sync buffer with current value
-        SyncNumericInputBuffer(id, *value, config.precision, isEditing);
+        NumericInputData& data = SyncNumericInputBuffer(entry, *value, config.precision, isEditing);
 
         // Get animation state - use mouse position for hover detection (no InvisibleButton)
-        Animation::WidgetState& state = Animation::GetState(id);
+        Animation::WidgetState& state = entry.anim;
         ImVec2 mousePos = ImGui::GetMousePos();
         bool hovered = (mousePos.x >= boxMin.x && mousePos.x <= boxMax.x &&
                         mousePos.y >= boxMin.y && mousePos.y <= boxMax.y);
@@ -209,7 +203,7 @@ namespace EFIGUI
         float verticalPadding = (height - textHeight) * 0.5f;
 
         // Calculate horizontal padding based on alignment
-        float textWidth = ImGui::CalcTextSize(buffers[id].buffer.c_str()).x;
+        float textWidth = ImGui::CalcTextSize(data.buffer.c_str()).x;
         float dynamicPaddingX = paddingX;  // Default left-aligned
 
         switch (config.alignment)
@@ -243,14 +237,14 @@ namespace EFIGUI
 
         // Prepare buffer for InputText
         char inputBuf[32];
-        strncpy(inputBuf, buffers[id].buffer.c_str(), sizeof(inputBuf) - 1);
+        strncpy(inputBuf, data.buffer.c_str(), sizeof(inputBuf) - 1);
         inputBuf[sizeof(inputBuf) - 1] = '\0';
 
-        bool enterPressed = ImGui::InputText(inputIdStr.c_str(), inputBuf, sizeof(inputBuf),
+        bool enterPressed = ImGui::InputText(inputIdStr, inputBuf, sizeof(inputBuf),
             ImGuiInputTextFlags_CharsDecimal | ImGuiInputTextFlags_EnterReturnsTrue | ImGuiInputTextFlags_AutoSelectAll);
 
         // Update buffer from InputText
-        buffers[id].buffer = inputBuf;
+        data.buffer = inputBuf;
 
         ImGui::PopStyleVar(3);
         ImGui::PopStyleColor(5);
@@ -260,7 +254,7 @@ namespace EFIGUI
         // Apply value on Enter or when focus is lost after editing
         if (enterPressed || ImGui::IsItemDeactivatedAfterEdit())
         {
-            changed = ApplyNumericInputValue(id, value, config.min, config.max, config.precision);
+            changed = ApplyNumericInputValue(data, value, config.min, config.max, config.precision);
         }
 
         // Advance cursor
@@ -275,19 +269,9 @@ namespace EFIGUI
 
     void PruneNumericInputBuffers(int maxIdleFrames)
     {
-        auto& buffers = GetNumericInputBuffers();
         int currentFrame = ImGui::GetFrameCount();
-
-        for (auto it = buffers.begin(); it != buffers.end(); )
-        {
-            if (currentFrame - it->second.lastUpdateFrame > maxIdleFrames)
-            {
-                it = buffers.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-        }
+        GetWidgetStore().DetachSideIf<NumericInputData>([&](const WidgetEntry&, const NumericInputData& data) {
+            return currentFrame - data.lastUpdateFrame > maxIdleFrames;
+        });
     }
 }
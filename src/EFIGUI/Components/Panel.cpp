@@ -51,6 +51,7 @@ namespace EFIGUI
             // Glow effect on top edge - use custom or theme color
             ImU32 effectiveGlowColor = glowColor.value_or(Theme::AccentCyan());
             float glowIntensity = Animation::Breathe(1.0f) * 0.3f + 0.2f;
+            Animation::RequestRedraw();
             auto glowRGB = Theme::ExtractRGB(effectiveGlowColor);
             ImU32 glowColorWithAlpha = IM_COL32(glowRGB.r, glowRGB.g, glowRGB.b, (int)(glowIntensity * 80));
             draw->AddLine(
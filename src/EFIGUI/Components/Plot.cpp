@@ -1,7 +1,9 @@
 // src/EFIGUI/Components/Plot.cpp
 #include "Plot.h"
 #include "../Core/Animation.h"
+#include "../Core/Decimation.h"
 #include "../Core/Draw.h"
+#include "../Core/EFIGUI.h"
 #include "../Core/Layer.h"
 #include "../Core/Style.h"
 #include "imgui_internal.h"
@@ -36,39 +38,240 @@ static void DrawGrid(ImDrawList* draw, const ImRect& bb, const PlotStyle& style)
     }
 }
 
-// Calculate auto scale
-static void CalculateAutoScale(const float* values, int count, int offset, int stride,
-                                float& scale_min, float& scale_max) {
+// Where a plot reads its samples: a strided float array, or a fill callback
+// read in chunks (getter and typed overloads)
+struct PlotSource {
+    const float* values = nullptr;
+    int stride = sizeof(float);
+    SeriesFill fill = nullptr;
+    void* data = nullptr;
+    int count = 0;
+    int offset = 0;         // Oldest sample, in [0, count)
+};
+
+static PlotSource MakeSource(const float* values, SeriesFill fill, void* data,
+                             int values_count, int values_offset, int stride) {
+    PlotSource source;
+    source.values = values;
+    source.stride = stride;
+    source.fill = fill;
+    source.data = data;
+    source.count = values_count;
+    source.offset = values_count > 0 ? ((values_offset % values_count) + values_count) % values_count : 0;
+    return source;
+}
+
+// Min/max of the samples a fill source delivered while the series was built
+struct ReadRange {
+    bool complete = false;  // Every sample was read
+    float min = FLT_MAX;
+    float max = -FLT_MAX;
+};
+
+// Calculate auto scale (only when a bound is left at FLT_MAX). Extrema do not
+// depend on the ring offset, so arrays are scanned in storage order. Fill
+// sources reuse what was read to build the series (the reader's range, or
+// every sample as points) and are only scanned again if neither covers them.
+static void CalculateAutoScale(const PlotSource& source, const float* points, int pointCount,
+                               const ReadRange& read, float& scale_min, float& scale_max) {
+    const int count = source.count;
     if (count <= 0)
         return;
 
-    float min_val = FLT_MAX;
-    float max_val = -FLT_MAX;
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX) {
+        float min_val = FLT_MAX;
+        float max_val = -FLT_MAX;
+
+        if (source.fill) {
+            if (read.complete) {
+                min_val = read.min;
+                max_val = read.max;
+            } else if (pointCount == count) {
+                AccumulateMinMax(points, pointCount, min_val, max_val);
+            } else {
+                float chunk[ChunkedReader::ChunkSize];
+                for (int start = 0; start < count; start += ChunkedReader::ChunkSize) {
+                    const int n = std::min(ChunkedReader::ChunkSize, count - start);
+                    source.fill(source.data, start, n, chunk);
+                    AccumulateMinMax(chunk, n, min_val, max_val);
+                }
+            }
+        } else if (source.stride == sizeof(float)) {
+            AccumulateMinMax(source.values, count, min_val, max_val);
+        } else {
+            const char* p = reinterpret_cast<const char*>(source.values);
+            for (int i = 0; i < count; ++i, p += source.stride) {
+                float v = *reinterpret_cast<const float*>(p);
+                if (v < min_val) min_val = v;
+                if (v > max_val) max_val = v;
+            }
+        }
 
-    for (int i = 0; i < count; ++i) {
-        int idx = (offset + i) % count;
-        const float* p = reinterpret_cast<const float*>(
-            reinterpret_cast<const char*>(values) + idx * stride);
-        float v = *p;
-        if (v < min_val) min_val = v;
-        if (v > max_val) max_val = v;
+        if (scale_min == FLT_MAX)
+            scale_min = min_val;
+        if (scale_max == FLT_MAX)
+            scale_max = max_val;
     }
 
-    if (scale_min == FLT_MAX)
-        scale_min = min_val;
-    if (scale_max == FLT_MAX)
-        scale_max = max_val;
-
     if (scale_max == scale_min) {
         scale_max = scale_min + 1.0f;
     }
 }
 
+// Filled circle markers for every point as one primitive: a fan per marker
+// plus a one pixel anti-aliasing fringe, sharing one reservation
+static void AddMarkers(ImDrawList* draw, const ImVec2* points, int count, float radius, ImU32 color) {
+    constexpr int Segments = 12;
+    struct UnitCircle { float cos[Segments]; float sin[Segments]; };
+    static const UnitCircle s_circle = [] {
+        UnitCircle circle;
+        for (int s = 0; s < Segments; ++s) {
+            float angle = (2.0f * 3.14159265f * s) / Segments;
+            circle.cos[s] = std::cos(angle);
+            circle.sin[s] = std::sin(angle);
+        }
+        return circle;
+    }();
+
+    // Keep each batch within 16-bit indices
+    constexpr int VtxPerMarker = 1 + Segments * 2;
+    constexpr int IdxPerMarker = Segments * 3 + Segments * 6;
+    constexpr int MarkersPerBatch = 60000 / VtxPerMarker;
+
+    const ImVec2 uv = draw->_Data->TexUvWhitePixel;
+    const ImU32 transparent = color & ~IM_COL32_A_MASK;
+    const float inner = radius - 0.5f > 0.0f ? radius - 0.5f : 0.0f;
+    const float outer = radius + 0.5f;
+
+    for (int first = 0; first < count; first += MarkersPerBatch) {
+        const int batch = std::min(MarkersPerBatch, count - first);
+        draw->PrimReserve(batch * IdxPerMarker, batch * VtxPerMarker);
+        for (int m = 0; m < batch; ++m) {
+            const ImVec2 c = points[first + m];
+            const unsigned int base = draw->_VtxCurrentIdx;
+            draw->PrimWriteVtx(c, uv, color);
+            for (int s = 0; s < Segments; ++s) {
+                draw->PrimWriteVtx(ImVec2(c.x + s_circle.cos[s] * inner, c.y + s_circle.sin[s] * inner), uv, color);
+                draw->PrimWriteVtx(ImVec2(c.x + s_circle.cos[s] * outer, c.y + s_circle.sin[s] * outer), uv, transparent);
+            }
+            for (int s = 0; s < Segments; ++s) {
+                const unsigned int a = base + 1 + s * 2;
+                const unsigned int b = base + 1 + ((s + 1) % Segments) * 2;
+                draw->PrimWriteIdx((ImDrawIdx)base);
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)b);
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)b);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)(a + 1));
+            }
+        }
+    }
+}
+
+// One joined polyline per run of points: ImDrawList::AddPolyline emits up to
+// 4 vertices per point (anti-aliased thick lines), so long series are split
+// into runs that stay within 16-bit indices, each run starting at the
+// previous run's last point to keep the line connected
+static void AddLineRuns(ImDrawList* draw, const ImVec2* points, int count, ImU32 color, float thickness) {
+    constexpr int VtxPerPoint = 4;
+    constexpr int PointsPerRun = 60000 / VtxPerPoint;
+
+    for (int first = 0; first < count - 1; first += PointsPerRun - 1) {
+        const int run = std::min(PointsPerRun, count - first);
+        draw->AddPolyline(points + first, run, color, ImDrawFlags_None, thickness);
+    }
+}
+
+// Reduce the series to at most ~2 points per pixel column (style.decimation),
+// resolving the ring-buffer offset and stride. Fill sources are read through
+// a ChunkedReader whose cache spans LTTB's look-ahead, so each sample is
+// converted once and its min/max lands in outRead.
+// Returns the point count; outT is the position along the x axis in [0, 1].
+static int BuildLineSeries(const PlotSource& source, float width, const PlotStyle& style,
+                           float*& outT, float*& outValue, ReadRange& outRead) {
+    const int values_count = source.count;
+    const int offset = source.offset;
+
+    const int columns = std::max(1, static_cast<int>(width));
+    const bool decimate = style.decimation != PlotDecimation::None && values_count > columns * 2;
+    const int capacity = decimate ? columns * 2 : values_count;
+
+    FrameArena& arena = GetFrameArena();
+    outT = arena.AllocateArray<float>(capacity);
+    outValue = arena.AllocateArray<float>(capacity);
+
+    auto reduce = [&](auto sample) {
+        if (style.decimation == PlotDecimation::LTTB)
+            return DecimateLTTB(sample, values_count, capacity, outT, outValue);
+        return DecimateMinMax(sample, values_count, columns, outT, outValue);
+    };
+
+    int count;
+    if (!decimate) {
+        if (source.fill) {
+            ReadSeries(source.fill, source.data, values_count, offset, 0, values_count, outValue);
+        } else {
+            // Unwrap the ring as two linear runs: [offset, count) then [0, offset)
+            const char* base = reinterpret_cast<const char*>(source.values);
+            int i = 0;
+            for (int idx = offset; idx < values_count; ++idx, ++i)
+                outValue[i] = *reinterpret_cast<const float*>(base + idx * source.stride);
+            for (int idx = 0; idx < offset; ++idx, ++i)
+                outValue[i] = *reinterpret_cast<const float*>(base + idx * source.stride);
+        }
+        for (int i = 0; i < values_count; ++i)
+            outT[i] = static_cast<float>(i);
+        count = values_count;
+    } else if (source.fill) {
+        // LTTB reads the next bucket before picking from the current one
+        ChunkedReader::Chunk* cache = nullptr;
+        int cacheChunks = 0;
+        if (style.decimation == PlotDecimation::LTTB) {
+            const int bucket = (values_count - 2) / std::max(1, capacity - 2) + 1;
+            cacheChunks = ChunkedReader::CacheChunksForSpan(bucket * 2 + 1);
+            if (cacheChunks > 2)
+                cache = arena.AllocateArray<ChunkedReader::Chunk>(cacheChunks);
+        }
+        ChunkedReader reader(source.fill, source.data, values_count, offset, cache, cacheChunks);
+        count = reduce([&](int i) { return reader(i); });
+        outRead.complete = reader.HasReadAll();
+        outRead.min = reader.GetMin();
+        outRead.max = reader.GetMax();
+    } else {
+        count = reduce([&](int i) {
+            int idx = offset + i;
+            if (idx >= values_count)
+                idx -= values_count;
+            return *reinterpret_cast<const float*>(
+                reinterpret_cast<const char*>(source.values) + idx * source.stride);
+        });
+    }
+
+    const float invLast = 1.0f / (values_count - 1);
+    for (int i = 0; i < count; ++i)
+        outT[i] *= invLast;
+    return count;
+}
+
+// Per-index getter callback (the ImGui-style API) adapted to a fill source
+struct GetterSource {
+    float (*getter)(void* data, int idx);
+    void* data;
+};
+
+static void FillFromGetter(void* data, int start, int count, float* out) {
+    const GetterSource& source = *static_cast<const GetterSource*>(data);
+    for (int i = 0; i < count; ++i)
+        out[i] = source.getter(source.data, start + i);
+}
+
 // PlotLines Implementation
-void PlotLinesEx(const char* label, const float* values, int values_count,
-                 int values_offset, const char* overlay_text,
-                 float scale_min, float scale_max, ImVec2 graph_size,
-                 int stride, const PlotStyle& style) {
+static void PlotLinesImpl(const char* label, const PlotSource& source, const char* overlay_text,
+                          float scale_min, float scale_max, ImVec2 graph_size,
+                          const PlotStyle& style) {
     ImGuiWindow* window = ImGui::GetCurrentWindow();
     if (window->SkipItems)
         return;
@@ -96,7 +299,20 @@ void PlotLinesEx(const char* label, const float* values, int values_count,
     bool hovered = ImGui::IsItemHovered();
     Animation::UpdateWidgetState(animState, hovered, false, false);
 
-    CalculateAutoScale(values, values_count, values_offset, stride, scale_min, scale_max);
+    ImRect inner_bb(frame_bb.Min.x + style.padding, frame_bb.Min.y + style.padding,
+                    frame_bb.Max.x - style.padding, frame_bb.Max.y - style.padding);
+
+    // Build the (decimated) series first so fill sources can be auto-scaled
+    // from the samples already read
+    const int values_count = source.count;
+    float* seriesT = nullptr;
+    float* seriesValue = nullptr;
+    int pointCount = 0;
+    ReadRange read;
+    if (values_count > 1)
+        pointCount = BuildLineSeries(source, inner_bb.GetWidth(), style, seriesT, seriesValue, read);
+
+    CalculateAutoScale(source, seriesValue, pointCount, read, scale_min, scale_max);
 
     ImDrawList* draw = window->DrawList;
 
@@ -108,78 +324,31 @@ void PlotLinesEx(const char* label, const float* values, int values_count,
     draw->AddRect(frame_bb.Min, frame_bb.Max, borderColor, style.rounding, 0, style.borderWidth);
 
     // Draw grid
-    ImRect inner_bb(frame_bb.Min.x + style.padding, frame_bb.Min.y + style.padding,
-                    frame_bb.Max.x - style.padding, frame_bb.Max.y - style.padding);
     DrawGrid(draw, inner_bb, style);
 
     // Draw line plot
-    if (values_count > 1) {
+    if (pointCount > 1) {
         float width = inner_bb.GetWidth();
         float height = inner_bb.GetHeight();
         float inv_scale = (scale_max == scale_min) ? 0.0f : 1.0f / (scale_max - scale_min);
 
-        // Draw glow first (if hovered)
-        if (animState.hoverAnim > 0.1f) {
-            for (int i = 0; i < values_count - 1; ++i) {
-                int idx0 = (values_offset + i) % values_count;
-                int idx1 = (values_offset + i + 1) % values_count;
-
-                const float* p0 = reinterpret_cast<const float*>(
-                    reinterpret_cast<const char*>(values) + idx0 * stride);
-                const float* p1 = reinterpret_cast<const float*>(
-                    reinterpret_cast<const char*>(values) + idx1 * stride);
-
-                float t0 = (float)i / (values_count - 1);
-                float t1 = (float)(i + 1) / (values_count - 1);
-
-                float y0 = 1.0f - ((*p0 - scale_min) * inv_scale);
-                float y1 = 1.0f - ((*p1 - scale_min) * inv_scale);
-
-                ImVec2 point0(inner_bb.Min.x + t0 * width, inner_bb.Min.y + y0 * height);
-                ImVec2 point1(inner_bb.Min.x + t1 * width, inner_bb.Min.y + y1 * height);
-
-                ImU32 glowColor = (style.lineGlowColor & 0x00FFFFFF) |
-                                  (static_cast<ImU32>(animState.hoverAnim * 100) << 24);
-                draw->AddLine(point0, point1, glowColor, style.lineThickness + 4.0f);
-            }
+        ImVec2* points = GetFrameArena().AllocateArray<ImVec2>(pointCount);
+        for (int i = 0; i < pointCount; ++i) {
+            float y = 1.0f - ((seriesValue[i] - scale_min) * inv_scale);
+            points[i] = ImVec2(inner_bb.Min.x + seriesT[i] * width, inner_bb.Min.y + y * height);
         }
 
-        // Draw main line
-        for (int i = 0; i < values_count - 1; ++i) {
-            int idx0 = (values_offset + i) % values_count;
-            int idx1 = (values_offset + i + 1) % values_count;
-
-            const float* p0 = reinterpret_cast<const float*>(
-                reinterpret_cast<const char*>(values) + idx0 * stride);
-            const float* p1 = reinterpret_cast<const float*>(
-                reinterpret_cast<const char*>(values) + idx1 * stride);
-
-            float t0 = (float)i / (values_count - 1);
-            float t1 = (float)(i + 1) / (values_count - 1);
-
-            float y0 = 1.0f - ((*p0 - scale_min) * inv_scale);
-            float y1 = 1.0f - ((*p1 - scale_min) * inv_scale);
-
-            ImVec2 point0(inner_bb.Min.x + t0 * width, inner_bb.Min.y + y0 * height);
-            ImVec2 point1(inner_bb.Min.x + t1 * width, inner_bb.Min.y + y1 * height);
-
-            draw->AddLine(point0, point1, style.lineColor, style.lineThickness);
+        // Draw glow first (if hovered), then the main line; each is joined polyline runs
+        if (animState.hoverAnim > 0.1f) {
+            ImU32 glowColor = (style.lineGlowColor & 0x00FFFFFF) |
+                              (static_cast<ImU32>(animState.hoverAnim * 100) << 24);
+            AddLineRuns(draw, points, pointCount, glowColor, style.lineThickness + 4.0f);
         }
+        AddLineRuns(draw, points, pointCount, style.lineColor, style.lineThickness);
 
         // Draw points if enabled
-        if (style.showPoints && style.pointRadius > 0) {
-            for (int i = 0; i < values_count; ++i) {
-                int idx = (values_offset + i) % values_count;
-                const float* p = reinterpret_cast<const float*>(
-                    reinterpret_cast<const char*>(values) + idx * stride);
-
-                float t = (float)i / (values_count - 1);
-                float y = 1.0f - ((*p - scale_min) * inv_scale);
-
-                ImVec2 point(inner_bb.Min.x + t * width, inner_bb.Min.y + y * height);
-                draw->AddCircleFilled(point, style.pointRadius, style.pointColor);
-            }
-        }
+        if (style.showPoints && style.pointRadius > 0)
+            AddMarkers(draw, points, pointCount, style.pointRadius, style.pointColor);
     }
 
     // Draw overlay text
@@ -198,6 +367,14 @@ void PlotLinesEx(const char* label, const float* values, int values_count,
     }
 }
 
+void PlotLinesEx(const char* label, const float* values, int values_count,
+                 int values_offset, const char* overlay_text,
+                 float scale_min, float scale_max, ImVec2 graph_size,
+                 int stride, const PlotStyle& style) {
+    PlotLinesImpl(label, MakeSource(values, nullptr, nullptr, values_count, values_offset, stride),
+                  overlay_text, scale_min, scale_max, graph_size, style);
+}
+
 void PlotLines(const char* label, const float* values, int values_count,
                int values_offset, const char* overlay_text,
                float scale_min, float scale_max, ImVec2 graph_size, int stride) {
@@ -211,36 +388,35 @@ void PlotLines(const char* label,
                int values_count, int values_offset,
                const char* overlay_text,
                float scale_min, float scale_max, ImVec2 graph_size) {
-    // Stack buffer for small data (256 floats = 1KB, safe for stack)
-    constexpr int STACK_THRESHOLD = 256;
-    float stackBuffer[STACK_THRESHOLD];
-
-    // Heap buffer for large data
-    std::vector<float> heapBuffer;
+    GetterSource getter{ values_getter, data };
+    PlotLines(label, &FillFromGetter, &getter, values_count, values_offset, overlay_text,
+              scale_min, scale_max, graph_size);
+}
 
-    // Choose buffer based on size
-    float* values;
-    if (values_count <= STACK_THRESHOLD) {
-        values = stackBuffer;
-    } else {
-        heapBuffer.resize(values_count);
-        values = heapBuffer.data();
-    }
+void PlotLines(const char* label, SeriesFill fill, void* data,
+               int values_count, int values_offset,
+               const char* overlay_text,
+               float scale_min, float scale_max, ImVec2 graph_size) {
+    PlotLinesImpl(label, MakeSource(nullptr, fill, data, values_count, values_offset, sizeof(float)),
+                  overlay_text, scale_min, scale_max, graph_size,
+                  StyleSystem::GetCurrentStyle<PlotStyle>());
+}
 
-    // Fill buffer from getter
-    for (int i = 0; i < values_count; ++i) {
-        values[i] = values_getter(data, i);
-    }
+void PlotLines(const char* label, const StreamingSeries& series,
+               const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size) {
+    // Running extrema instead of a rescan
+    if (scale_min == FLT_MAX && !series.Empty()) scale_min = series.Min();
+    if (scale_max == FLT_MAX && !series.Empty()) scale_max = series.Max();
+    if (scale_max == scale_min) scale_max = scale_min + 1.0f;
 
-    PlotLines(label, values, values_count, values_offset, overlay_text,
+    PlotLines(label, series.Data(), series.Size(), series.Offset(), overlay_text,
               scale_min, scale_max, graph_size, sizeof(float));
 }
 
 // PlotHistogram Implementation
-void PlotHistogramEx(const char* label, const float* values, int values_count,
-                     int values_offset, const char* overlay_text,
-                     float scale_min, float scale_max, ImVec2 graph_size,
-                     int stride, const PlotStyle& style) {
+static void PlotHistogramImpl(const char* label, PlotSource source, const char* overlay_text,
+                              float scale_min, float scale_max, ImVec2 graph_size,
+                              const PlotStyle& style) {
     ImGuiWindow* window = ImGui::GetCurrentWindow();
     if (window->SkipItems)
         return;
@@ -268,7 +444,14 @@ void PlotHistogramEx(const char* label, const float* values, int values_count,
     bool hovered = ImGui::IsItemHovered();
     Animation::UpdateWidgetState(animState, hovered, false, false);
 
-    CalculateAutoScale(values, values_count, values_offset, stride, scale_min, scale_max);
+    // Every bar is drawn: read a fill source once, now that the plot is visible
+    const int values_count = source.count;
+    if (source.fill && values_count > 0) {
+        float* values = GetFrameArena().AllocateArray<float>(values_count);
+        ReadSeries(source.fill, source.data, values_count, source.offset, 0, values_count, values);
+        source = MakeSource(values, nullptr, nullptr, values_count, 0, sizeof(float));
+    }
+    CalculateAutoScale(source, nullptr, 0, ReadRange{}, scale_min, scale_max);
 
     ImDrawList* draw = window->DrawList;
 
@@ -301,10 +484,13 @@ void PlotHistogramEx(const char* label, const float* values, int values_count,
                 hoveredBar = -1;
         }
 
-        for (int i = 0; i < values_count; ++i) {
-            int idx = (values_offset + i) % values_count;
+        // Walk the ring from the oldest sample, wrapping once
+        int idx = source.offset;
+        for (int i = 0; i < values_count; ++i, ++idx) {
+            if (idx == values_count)
+                idx = 0;
             const float* p = reinterpret_cast<const float*>(
-                reinterpret_cast<const char*>(values) + idx * stride);
+                reinterpret_cast<const char*>(source.values) + idx * source.stride);
             float v = *p;
 
             float normalized = (v - scale_min) * inv_scale;
@@ -324,7 +510,7 @@ void PlotHistogramEx(const char* label, const float* values, int values_count,
             // Draw glow on hovered bar
             if (i == hoveredBar) {
                 Draw::RectGlow(bar_min, bar_max, style.highlightGlowColor,
-                               style.glowIntensity, 3.0f);
+                               style.glowIntensity, 3.0f, 2.0f);
 
                 char buf[64];
                 snprintf(buf, sizeof(buf), "%.2f", v);
@@ -349,6 +535,14 @@ void PlotHistogramEx(const char* label, const float* values, int values_count,
     }
 }
 
+void PlotHistogramEx(const char* label, const float* values, int values_count,
+                     int values_offset, const char* overlay_text,
+                     float scale_min, float scale_max, ImVec2 graph_size,
+                     int stride, const PlotStyle& style) {
+    PlotHistogramImpl(label, MakeSource(values, nullptr, nullptr, values_count, values_offset, stride),
+                      overlay_text, scale_min, scale_max, graph_size, style);
+}
+
 void PlotHistogram(const char* label, const float* values, int values_count,
                    int values_offset, const char* overlay_text,
                    float scale_min, float scale_max, ImVec2 graph_size, int stride) {
@@ -362,28 +556,27 @@ void PlotHistogram(const char* label,
                    int values_count, int values_offset,
                    const char* overlay_text,
                    float scale_min, float scale_max, ImVec2 graph_size) {
-    // Stack buffer for small data (256 floats = 1KB, safe for stack)
-    constexpr int STACK_THRESHOLD = 256;
-    float stackBuffer[STACK_THRESHOLD];
-
-    // Heap buffer for large data
-    std::vector<float> heapBuffer;
+    GetterSource getter{ values_getter, data };
+    PlotHistogram(label, &FillFromGetter, &getter, values_count, values_offset, overlay_text,
+                  scale_min, scale_max, graph_size);
+}
 
-    // Choose buffer based on size
-    float* values;
-    if (values_count <= STACK_THRESHOLD) {
-        values = stackBuffer;
-    } else {
-        heapBuffer.resize(values_count);
-        values = heapBuffer.data();
-    }
+void PlotHistogram(const char* label, SeriesFill fill, void* data,
+                   int values_count, int values_offset,
+                   const char* overlay_text,
+                   float scale_min, float scale_max, ImVec2 graph_size) {
+    PlotHistogramImpl(label, MakeSource(nullptr, fill, data, values_count, values_offset, sizeof(float)),
+                      overlay_text, scale_min, scale_max, graph_size,
+                      StyleSystem::GetCurrentStyle<PlotStyle>());
+}
 
-    // Fill buffer from getter
-    for (int i = 0; i < values_count; ++i) {
-        values[i] = values_getter(data, i);
-    }
+void PlotHistogram(const char* label, const StreamingSeries& series,
+                   const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size) {
+    if (scale_min == FLT_MAX && !series.Empty()) scale_min = series.Min();
+    if (scale_max == FLT_MAX && !series.Empty()) scale_max = series.Max();
+    if (scale_max == scale_min) scale_max = scale_min + 1.0f;
 
-    PlotHistogram(label, values, values_count, values_offset, overlay_text,
+    PlotHistogram(label, series.Data(), series.Size(), series.Offset(), overlay_text,
                   scale_min, scale_max, graph_size, sizeof(float));
 }
 
@@ -2,6 +2,7 @@
 #pragma once
 #include "imgui.h"
 #include "../Styles/PlotStyle.h"
+#include "../Core/Series.h"
 #include <cfloat>
 
 namespace EFIGUI {
@@ -20,6 +21,50 @@ void PlotLines(const char* label,
                float scale_min = FLT_MAX, float scale_max = FLT_MAX,
                ImVec2 graph_size = ImVec2(0, 0));
 
+/// PlotLines with a chunked fill callback: fill(data, start, count, out) writes
+/// a run of samples. Each sample is read at most once (auto-scale reuses that
+/// read), through a few cached chunks instead of a full copy, and nothing is
+/// read when the plot is clipped
+void PlotLines(const char* label, SeriesFill fill, void* data,
+               int values_count, int values_offset = 0,
+               const char* overlay_text = nullptr,
+               float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+               ImVec2 graph_size = ImVec2(0, 0));
+
+/// PlotLines from double, int32_t, int64_t, uint16_t... samples with a byte
+/// stride, converted chunk by chunk as they are read
+template<typename T>
+void PlotLines(const char* label, const T* values, int values_count,
+               int values_offset = 0, const char* overlay_text = nullptr,
+               float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+               ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(T)) {
+    StridedSource source{ values, stride };
+    PlotLines(label, &FillStrided<T>, &source, values_count, values_offset, overlay_text,
+              scale_min, scale_max, graph_size);
+}
+
+/// PlotLines from a float series: no copy, the ring is unwrapped as two linear
+/// runs and auto-scale uses its running min/max
+void PlotLines(const char* label, const StreamingSeries& series,
+               const char* overlay_text = nullptr,
+               float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+               ImVec2 graph_size = ImVec2(0, 0));
+
+/// PlotLines from a series of another arithmetic type (converted chunk by
+/// chunk as it is read)
+template<typename T>
+void PlotLines(const char* label, const ScrollingSeries<T>& series,
+               const char* overlay_text = nullptr,
+               float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+               ImVec2 graph_size = ImVec2(0, 0)) {
+    if (scale_min == FLT_MAX && !series.Empty()) scale_min = static_cast<float>(series.Min());
+    if (scale_max == FLT_MAX && !series.Empty()) scale_max = static_cast<float>(series.Max());
+    if (scale_max == scale_min) scale_max = scale_min + 1.0f;
+
+    PlotLines(label, series.Data(), series.Size(), series.Offset(), overlay_text,
+              scale_min, scale_max, graph_size, sizeof(T));
+}
+
 /// PlotLines with custom style
 void PlotLinesEx(const char* label, const float* values, int values_count,
                  int values_offset, const char* overlay_text,
@@ -40,6 +85,31 @@ void PlotHistogram(const char* label,
                    float scale_min = FLT_MAX, float scale_max = FLT_MAX,
                    ImVec2 graph_size = ImVec2(0, 0));
 
+/// PlotHistogram with a chunked fill callback (read once, after clipping)
+void PlotHistogram(const char* label, SeriesFill fill, void* data,
+                   int values_count, int values_offset = 0,
+                   const char* overlay_text = nullptr,
+                   float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+                   ImVec2 graph_size = ImVec2(0, 0));
+
+/// PlotHistogram from double, int32_t, int64_t, uint16_t... samples with a
+/// byte stride
+template<typename T>
+void PlotHistogram(const char* label, const T* values, int values_count,
+                   int values_offset = 0, const char* overlay_text = nullptr,
+                   float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+                   ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(T)) {
+    StridedSource source{ values, stride };
+    PlotHistogram(label, &FillStrided<T>, &source, values_count, values_offset, overlay_text,
+                  scale_min, scale_max, graph_size);
+}
+
+/// PlotHistogram from a streaming series (auto-scale uses its running min/max)
+void PlotHistogram(const char* label, const StreamingSeries& series,
+                   const char* overlay_text = nullptr,
+                   float scale_min = FLT_MAX, float scale_max = FLT_MAX,
+                   ImVec2 graph_size = ImVec2(0, 0));
+
 /// PlotHistogram with custom style
 void PlotHistogramEx(const char* label, const float* values, int values_count,
                      int values_offset, const char* overlay_text,
@@ -24,7 +24,7 @@ bool BeginPopupEx(const char* str_id, ImGuiWindowFlags flags, const PopupStyle&
         ImVec2 pos = ImGui::GetWindowPos();
         ImVec2 size = ImGui::GetWindowSize();
         Draw::RectGlow(pos, ImVec2(pos.x + size.x, pos.y + size.y),
-                       style.glowColor, style.glowIntensity, 6.0f);
+                       style.glowColor, style.glowIntensity, 6.0f, style.rounding);
     }
 
     if (!open) {
@@ -42,6 +42,7 @@ bool BeginPopup(const char* str_id, ImGuiWindowFlags flags) {
 // IMPORTANT: Always use EFIGUI::EndPopup() with EFIGUI::BeginPopup().
 // Mixing with ImGui::EndPopup() will cause style stack imbalance.
 void EndPopup() {
+    Layers().FlushWindow();
     ImGui::EndPopup();
     // Pop in reverse order (LIFO): 3 StyleVars, then 2 StyleColors
     ImGui::PopStyleVar(3);
@@ -63,7 +64,7 @@ bool BeginPopupModalEx(const char* name, bool* p_open, ImGuiWindowFlags flags, c
         ImVec2 pos = ImGui::GetWindowPos();
         ImVec2 size = ImGui::GetWindowSize();
         Draw::RectGlow(pos, ImVec2(pos.x + size.x, pos.y + size.y),
-                       style.glowColor, style.glowIntensity, 8.0f);
+                       style.glowColor, style.glowIntensity, 8.0f, style.rounding);
     }
 
     if (!open) {
@@ -81,6 +82,7 @@ bool BeginPopupModal(const char* name, bool* p_open, ImGuiWindowFlags flags) {
 // IMPORTANT: Always use EFIGUI::EndPopupModal() with EFIGUI::BeginPopupModal().
 // Mixing with ImGui::EndPopup() will cause style stack imbalance.
 void EndPopupModal() {
+    Layers().FlushWindow();
     ImGui::EndPopup();
     // Pop in reverse order (LIFO): 3 StyleVars, then 3 StyleColors (Modal has extra dim color)
     ImGui::PopStyleVar(3);
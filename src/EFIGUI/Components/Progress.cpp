@@ -65,6 +65,8 @@ namespace EFIGUI
 
         float effectiveDotSize = dotSize.value_or(Theme::DefaultDotSize());
         float alpha = pulse ? (Animation::Pulse(2.0f) * 0.5f + 0.5f) : 1.0f;
+        if (pulse)
+            Animation::RequestRedraw();
 
         auto colorRGB = Theme::ExtractRGB(color);
         ImU32 dotColor = IM_COL32(colorRGB.r, colorRGB.g, colorRGB.b, (int)(alpha * 255));
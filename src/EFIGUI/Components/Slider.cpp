@@ -114,7 +114,8 @@ namespace EFIGUI
                     ImVec2(startX + fillWidth, trackY + trackHeight),
                     Theme::AccentCyanGlow(),
                     glowIntensity,
-                    GlowExpandSize
+                    GlowExpandSize,
+                    trackHeight * 0.5f
                 );
             }
         }
@@ -198,7 +199,7 @@ namespace EFIGUI
 
         // Create invisible button for slider interaction
         ImGui::SetCursorScreenPos(ImVec2(sliderStartX - knobPadding, pos.y));
-        ImGui::InvisibleButton((std::string(label) + "_slider").c_str(), ImVec2(sliderWidth + knobPadding * 2, height));
+        ImGui::InvisibleButton(GetFrameArena().Format("%s_slider", label), ImVec2(sliderWidth + knobPadding * 2, height));
         bool sliderHovered = ImGui::IsItemHovered();
         bool sliderActive = ImGui::IsItemActive();
 
@@ -226,8 +227,8 @@ namespace EFIGUI
             inputConfig.width = inputWidth;
 
             // Use unique ID for the input to avoid collision with slider
-            std::string inputLabel = std::string("##") + label + "_value";
-            if (NumericInput(inputLabel.c_str(), value, inputConfig, config.layer))
+            const char* inputLabel = GetFrameArena().Format("##%s_value", label);
+            if (NumericInput(inputLabel, value, inputConfig, config.layer))
             {
                 changed = true;
             }
@@ -104,7 +104,8 @@ namespace EFIGUI
                 ImVec2(pos.x + toggleWidth, pos.y + toggleHeight),
                 glowColor,
                 state.slideAnim * 0.5f,
-                glowRadius
+                glowRadius,
+                toggleHeight * 0.5f
             );
         }
 
@@ -110,7 +110,7 @@ bool VSliderFloatEx(const char* label, const ImVec2& size, float* v,
         if (animState.hoverAnim > 0.1f || held) {
             float glowIntensity = held ? 0.8f : animState.hoverAnim * 0.5f;
             Draw::RectGlow(fillMin, fillMax, style.fillGlowColor,
-                          glowIntensity, 4.0f);
+                          glowIntensity, 4.0f, style.trackRounding);
         }
     }
 
@@ -21,15 +21,9 @@ namespace EFIGUI
         ImVec2 titleMin = windowPos;
         ImVec2 titleMax = ImVec2(windowPos.x + windowSize.x, windowPos.y + titleHeight);
 
-        // Gradient background
-        Draw::RectGradientH(titleMin, titleMax, Theme::TitleBarLeft(), Theme::TitleBarRight(), Theme::WindowRounding());
-
-        // Only round top corners - fill the rest
-        draw->AddRectFilled(
-            ImVec2(titleMin.x, titleMin.y + Theme::WindowRounding()),
-            ImVec2(titleMax.x, titleMax.y),
-            Theme::TitleBarLeft()
-        );
+        // Gradient background (only the top corners are rounded)
+        Draw::RectGradientH(titleMin, titleMax, Theme::TitleBarLeft(), Theme::TitleBarRight(),
+                            Theme::WindowRounding(), ImDrawFlags_RoundCornersTop);
 
         // Neon accent line at bottom of title
         draw->AddLine(
@@ -192,6 +186,7 @@ namespace EFIGUI
 
     void EndCustomWindow()
     {
+        Layers().FlushWindow();
         ImGui::End();
     }
 
@@ -285,6 +280,7 @@ namespace EFIGUI
 
     void EndBorderlessWindow()
     {
+        Layers().FlushWindow();
         ImGui::End();
     }
 
@@ -369,6 +365,7 @@ namespace EFIGUI
             // Draw glow behind icon
             if (!headerHovered)
             {
+                Animation::RequestRedraw();
                 float glowRadius = glowRadiusBase + glowAnim * glowRadiusExpand;
                 ImU32 glowColorWithAlpha = IM_COL32(glowRGB.r, glowRGB.g, glowRGB.b, (int)(glowAnim * glowAnimAlpha));
                 draw->AddCircleFilled(
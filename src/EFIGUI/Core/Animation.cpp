@@ -1,37 +1,316 @@
 #include "Animation.h"
+#include "AnimationClock.h"
+#include "AnimationSpring.h"
+#include "Style.h"
+#include "WidgetStore.h"
+#include <cfloat>
 #include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EFIGUI_ANIMATION_SSE2 1
+#include <emmintrin.h>
+#endif
 
 namespace EFIGUI
 {
     namespace Animation
     {
-        // Static storage for widget states
-        static std::unordered_map<ImGuiID, WidgetState> s_widgetStates;
+        namespace
+        {
+            // Values within this distance of their target snap to it, so states
+            // settle exactly and the batched pass can skip them
+            constexpr float SettleEpsilon = 1.0f / 1024.0f;
+            constexpr float ClickDecayRate = 3.0f;
+            constexpr float GlowFrequency = 2.0f;
+
+            constexpr float TwoPi = 2.0f * 3.14159f;
+            constexpr int FrameCacheSlots = 8;
+
+            // A few (key -> value) results computed this frame. Widgets use a
+            // handful of distinct speeds and frequencies, so a linear scan over
+            // a small array beats recomputing pow/sin; extra keys are computed
+            // uncached once the slots are full.
+            struct CachedValues
+            {
+                float keys[FrameCacheSlots] = {};
+                float values[FrameCacheSlots] = {};
+                int count = 0;
+
+                template<typename Fn>
+                float Get(float key, Fn compute)
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        if (keys[i] == key)
+                            return values[i];
+                    }
+                    float value = compute(key);
+                    if (count < FrameCacheSlots)
+                    {
+                        keys[count] = key;
+                        values[count] = value;
+                        count++;
+                    }
+                    return value;
+                }
+            };
+
+            // Spring steps computed this frame, keyed by (frequency, damping)
+            struct CachedSpringSteps
+            {
+                SpringParams keys[FrameCacheSlots];
+                SpringStep values[FrameCacheSlots];
+                int count = 0;
+
+                SpringStep Get(const SpringParams& params, float dt)
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        if (keys[i].frequency == params.frequency && keys[i].damping == params.damping)
+                            return values[i];
+                    }
+                    SpringStep step = ComputeSpringStep(params.frequency, params.damping, dt);
+                    if (count < FrameCacheSlots)
+                    {
+                        keys[count] = params;
+                        values[count] = step;
+                        count++;
+                    }
+                    return step;
+                }
+            };
+
+            // Per-frame values shared by every widget, refreshed on first use
+            // in each ImGui frame: time, delta time, lerp factors by speed,
+            // spring steps by parameters and periodic functions by frequency
+            struct FrameCache
+            {
+                ImGuiContext* context = nullptr;
+                int frame = -1;
+                float time = 0.0f;
+                float dt = 0.0f;
+                CachedValues lerpFactors;
+                CachedSpringSteps springSteps;
+                CachedValues pulse;
+                CachedValues breathe;
+                CachedValues sweep;
+            };
+
+            // Targets recorded this frame, one entry per UpdateWidgetState call
+            // (structure of arrays so the pass can load four lanes at a time)
+            struct StateBatch
+            {
+                std::vector<WidgetState*> states;
+                std::vector<float> lerpFactor;
+                std::vector<float> hoverTarget;
+                std::vector<float> activeTarget;
+                std::vector<float> selectedTarget;
+
+                // Scratch for the current values, gathered at UpdateBatch
+                std::vector<float> hover;
+                std::vector<float> active;
+                std::vector<float> selected;
+                std::vector<float> click;
+
+                size_t lastCount = 0;
+
+                void Clear()
+                {
+                    states.clear();
+                    lerpFactor.clear();
+                    hoverTarget.clear();
+                    activeTarget.clear();
+                    selectedTarget.clear();
+                }
+            };
+
+            // Spring channels attached to a widget's WidgetStore entry
+            struct WidgetSprings
+            {
+                SpringChannel channels[4];
+            };
+
+            Clock& GetClock()
+            {
+                return StyleSystem::GetComponentState<Clock>();
+            }
+
+            FrameCache s_frameCache;
+            StateBatch s_batch;
+            SpringBatch s_springBatch;
+            bool s_batchedUpdate = false;
+
+            // Earliest redraw requested this frame / by the last published frame
+            float s_pendingRedrawDelay = FLT_MAX;
+            float s_publishedRedrawDelay = FLT_MAX;
+
+            bool IsSettled(float value, float target)
+            {
+                return std::fabs(target - value) < SettleEpsilon;
+            }
+
+            FrameCache& GetFrameCache()
+            {
+                ImGuiContext* context = ImGui::GetCurrentContext();
+                int frame = ImGui::GetFrameCount();
+                if (s_frameCache.frame != frame || s_frameCache.context != context)
+                {
+                    // A context switch within a frame re-reads the clock without advancing it
+                    Clock& clock = GetClock();
+                    clock.Tick(frame, ImGui::GetTime(), ImGui::GetIO().DeltaTime);
+
+                    s_frameCache = FrameCache{};
+                    s_frameCache.context = context;
+                    s_frameCache.frame = frame;
+                    s_frameCache.time = (float)clock.time;
+                    s_frameCache.dt = clock.dt;
+                }
+                return s_frameCache;
+            }
+
+            // Frame-rate independent lerp factor: 1 - 0.5^(dt * speed)
+            float GetLerpFactor(FrameCache& frame, float speed)
+            {
+                return frame.lerpFactors.Get(speed, [&](float s) {
+                    return 1.0f - std::pow(0.5f, frame.dt * s);
+                });
+            }
+
+            // v += (target - v) * t, snapping to target once within SettleEpsilon
+            void AdvanceLanes(float* values, const float* targets, const float* factors, size_t count)
+            {
+                size_t i = 0;
+#ifdef EFIGUI_ANIMATION_SSE2
+                const __m128 epsilon = _mm_set1_ps(SettleEpsilon);
+                const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 v = _mm_loadu_ps(values + i);
+                    __m128 target = _mm_loadu_ps(targets + i);
+                    __m128 t = _mm_loadu_ps(factors + i);
+                    v = _mm_add_ps(v, _mm_mul_ps(_mm_sub_ps(target, v), t));
+                    __m128 settled = _mm_cmplt_ps(_mm_and_ps(_mm_sub_ps(target, v), absMask), epsilon);
+                    v = _mm_or_ps(_mm_and_ps(settled, target), _mm_andnot_ps(settled, v));
+                    _mm_storeu_ps(values + i, v);
+                }
+#endif
+                for (; i < count; i++)
+                {
+                    float v = values[i] + (targets[i] - values[i]) * factors[i];
+                    values[i] = std::fabs(targets[i] - v) < SettleEpsilon ? targets[i] : v;
+                }
+            }
+
+            // Apply each lane's spring step; offset and velocity both within
+            // SettleEpsilon snap to rest
+            void StepSpringLanes(float* offsets, float* velocities, const float* a, const float* b,
+                                 const float* c, const float* d, size_t count)
+            {
+                size_t i = 0;
+#ifdef EFIGUI_ANIMATION_SSE2
+                const __m128 epsilon = _mm_set1_ps(SettleEpsilon);
+                const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m128 x = _mm_loadu_ps(offsets + i);
+                    __m128 v = _mm_loadu_ps(velocities + i);
+                    __m128 nx = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), x), _mm_mul_ps(_mm_loadu_ps(b + i), v));
+                    __m128 nv = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(c + i), x), _mm_mul_ps(_mm_loadu_ps(d + i), v));
+                    __m128 moving = _mm_or_ps(_mm_cmpge_ps(_mm_and_ps(nx, absMask), epsilon),
+                                              _mm_cmpge_ps(_mm_and_ps(nv, absMask), epsilon));
+                    _mm_storeu_ps(offsets + i, _mm_and_ps(moving, nx));
+                    _mm_storeu_ps(velocities + i, _mm_and_ps(moving, nv));
+                }
+#endif
+                for (; i < count; i++)
+                {
+                    float x = a[i] * offsets[i] + b[i] * velocities[i];
+                    float v = c[i] * offsets[i] + d[i] * velocities[i];
+                    bool moving = std::fabs(x) >= SettleEpsilon || std::fabs(v) >= SettleEpsilon;
+                    offsets[i] = moving ? x : 0.0f;
+                    velocities[i] = moving ? v : 0.0f;
+                }
+            }
+
+            // Advance the springs recorded in batched mode
+            void UpdateSpringBatch()
+            {
+                SpringBatch& batch = s_springBatch;
+                size_t count = batch.channels.size();
+                if (count == 0)
+                    return;
+
+                // Advanced values are first drawn next frame
+                RequestRedraw();
+
+                batch.offset.resize(count);
+                batch.velocity.resize(count);
+                for (size_t i = 0; i < count; i++)
+                {
+                    const SpringChannel* channel = batch.channels[i];
+                    batch.offset[i] = channel->value - channel->target;
+                    batch.velocity[i] = channel->velocity;
+                }
+
+                StepSpringLanes(batch.offset.data(), batch.velocity.data(), batch.a.data(), batch.b.data(),
+                                batch.c.data(), batch.d.data(), count);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    SpringChannel* channel = batch.channels[i];
+                    channel->value = channel->target + batch.offset[i];
+                    channel->velocity = batch.velocity[i];
+                }
+
+                batch.Clear();
+            }
+
+            // click = max(click - decay, 0)
+            void DecayLanes(float* values, float decay, size_t count)
+            {
+                size_t i = 0;
+#ifdef EFIGUI_ANIMATION_SSE2
+                const __m128 step = _mm_set1_ps(decay);
+                const __m128 zero = _mm_setzero_ps();
+                for (; i + 4 <= count; i += 4)
+                    _mm_storeu_ps(values + i, _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(values + i), step), zero));
+#endif
+                for (; i < count; i++)
+                    values[i] = values[i] > decay ? values[i] - decay : 0.0f;
+            }
+        }
 
         WidgetState& GetState(ImGuiID id)
         {
-            return s_widgetStates[id];
+            return GetWidgetStore().Get(id).anim;
+        }
+
+        size_t GetStateCount()
+        {
+            return GetWidgetStore().Size();
+        }
+
+        size_t GetStateMemoryBytes()
+        {
+            return GetWidgetStore().GetMemoryBytes();
         }
 
         void ClearStates()
         {
-            s_widgetStates.clear();
+            s_batch.Clear();
+            s_springBatch.Clear();
+            GetWidgetStore().Clear();
         }
 
         void PruneStaleStates(int maxIdleFrames)
         {
-            int currentFrame = ImGui::GetFrameCount();
-            for (auto it = s_widgetStates.begin(); it != s_widgetStates.end(); )
-            {
-                if (currentFrame - it->second.lastUpdateFrame > maxIdleFrames)
-                {
-                    it = s_widgetStates.erase(it);
-                }
-                else
-                {
-                    ++it;
-                }
-            }
+            GetWidgetStore().Prune(maxIdleFrames);
+        }
+
+        void PruneStaleStatesIncremental(int maxIdleFrames)
+        {
+            GetWidgetStore().PruneIncremental(maxIdleFrames);
         }
 
         // =============================================
@@ -40,9 +319,11 @@ namespace EFIGUI
 
         float Lerp(float current, float target, float speed)
         {
-            float dt = GetDeltaTime();
-            float t = 1.0f - std::pow(0.5f, dt * speed);
-            return current + (target - current) * t;
+            float t = GetLerpFactor(GetFrameCache(), speed);
+            float value = current + (target - current) * t;
+            if (!IsSettled(value, target))
+                RequestRedraw();
+            return value;
         }
 
         ImVec4 LerpColor(const ImVec4& current, const ImVec4& target, float speed)
@@ -76,116 +357,267 @@ namespace EFIGUI
         }
 
         // =============================================
-        // Easing Functions
+        // Periodic Functions
         // =============================================
 
-        float EaseOutQuad(float t)
-        {
-            return 1.0f - (1.0f - t) * (1.0f - t);
-        }
+        // Results are memoized per frame by frequency (see FrameCache)
 
-        float EaseInQuad(float t)
+        float Pulse(float frequency)
         {
-            return t * t;
+            FrameCache& frame = GetFrameCache();
+            return frame.pulse.Get(frequency, [&](float f) {
+                float t = frame.time * f;
+                return (std::sin(t * TwoPi) + 1.0f) * 0.5f;
+            });
         }
 
-        float EaseInOutQuad(float t)
+        float Breathe(float frequency)
         {
-            return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
+            FrameCache& frame = GetFrameCache();
+            return frame.breathe.Get(frequency, [&](float f) {
+                float t = frame.time * f;
+                // Smoother breathing curve
+                float val = (std::sin(t * TwoPi - 1.5708f) + 1.0f) * 0.5f;
+                return val * val;  // Square for more natural breathing
+            });
         }
 
-        float EaseOutBack(float t)
+        float Sweep(float frequency)
         {
-            const float c1 = 1.70158f;
-            const float c3 = c1 + 1.0f;
-            return 1.0f + c3 * std::pow(t - 1.0f, 3.0f) + c1 * std::pow(t - 1.0f, 2.0f);
+            FrameCache& frame = GetFrameCache();
+            return frame.sweep.Get(frequency, [&](float f) {
+                float t = frame.time * f;
+                // Simple sawtooth wave from 0 to 1, continuous and smooth
+                float phase = std::fmod(t, 1.0f);
+                if (phase < 0.0f) phase += 1.0f;  // Handle negative time
+                return phase;
+            });
         }
 
-        float EaseOutElastic(float t)
+        float Shimmer(float frequency, float offset)
         {
-            const float c4 = (2.0f * 3.14159f) / 3.0f;
-            if (t == 0.0f) return 0.0f;
-            if (t == 1.0f) return 1.0f;
-            return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
+            // Offsets differ per line, so only the time lookup is shared
+            float t = GetFrameCache().time * frequency + offset;
+            float phase = std::fmod(t, 1.0f);
+            return phase;
         }
 
         // =============================================
-        // Periodic Functions
+        // Utility
         // =============================================
 
-        float Pulse(float frequency)
+        float GetTime()
         {
-            float t = GetTime() * frequency;
-            return (std::sin(t * 2.0f * 3.14159f) + 1.0f) * 0.5f;
+            return GetFrameCache().time;
         }
 
-        float Breathe(float frequency)
+        float GetDeltaTime()
         {
-            float t = GetTime() * frequency;
-            // Smoother breathing curve
-            float val = (std::sin(t * 2.0f * 3.14159f - 1.5708f) + 1.0f) * 0.5f;
-            return val * val;  // Square for more natural breathing
+            return GetFrameCache().dt;
         }
 
-        float Sweep(float frequency)
-        {
-            float t = GetTime() * frequency;
-            // Simple sawtooth wave from 0 to 1, continuous and smooth
-            float phase = std::fmod(t, 1.0f);
-            if (phase < 0.0f) phase += 1.0f;  // Handle negative time
-            return phase;
-        }
+        // =============================================
+        // Time Source
+        // =============================================
 
-        float Shimmer(float frequency, float offset)
+        void SetTimeSource(TimeSource source, float fixedStep, double startTime)
         {
-            float t = GetTime() * frequency + offset;
-            float phase = std::fmod(t, 1.0f);
-            return phase;
+            Clock& clock = GetClock();
+            clock = Clock{};
+            clock.source = source;
+            clock.fixedStep = fixedStep;
+            clock.time = startTime;
+
+            // Re-read the clock on the next call, even within this frame
+            s_frameCache.frame = -1;
         }
 
-        // =============================================
-        // Utility
-        // =============================================
-
-        float GetTime()
+        TimeSource GetTimeSource()
         {
-            return (float)ImGui::GetTime();
+            return GetClock().source;
         }
 
-        float GetDeltaTime()
+        void AdvanceClock(float seconds)
         {
-            return ImGui::GetIO().DeltaTime;
+            Clock& clock = GetClock();
+            IM_ASSERT(clock.source == TimeSource::Manual && "EFIGUI: AdvanceClock requires TimeSource::Manual");
+            clock.pendingAdvance += seconds;
         }
 
+        // =============================================
+        // Widget State Update
+        // =============================================
+
         void UpdateWidgetState(WidgetState& state, bool isHovered, bool isActive, bool isSelected, float speed)
         {
-            float dt = GetDeltaTime();
-            float t = 1.0f - std::pow(0.5f, dt * speed);
+            FrameCache& frame = GetFrameCache();
+            float lerpFactor = GetLerpFactor(frame, speed);
 
             // Track when this state was last updated
-            state.lastUpdateFrame = ImGui::GetFrameCount();
+            state.lastUpdateFrame = frame.frame;
 
-            // Update hover
-            float targetHover = isHovered ? 1.0f : 0.0f;
-            state.hoverAnim += (targetHover - state.hoverAnim) * t;
+            // Glow phase is the same for every widget this frame
+            state.glowPhase = Breathe(GlowFrequency);
 
-            // Update active
+            float targetHover = isHovered ? 1.0f : 0.0f;
             float targetActive = isActive ? 1.0f : 0.0f;
-            state.activeAnim += (targetActive - state.activeAnim) * t;
-
-            // Update selected
             float targetSelected = isSelected ? 1.0f : 0.0f;
-            state.selectedAnim += (targetSelected - state.selectedAnim) * t;
 
-            // Update glow phase (continuous)
-            state.glowPhase = Breathe(2.0f);
+            if (s_batchedUpdate)
+            {
+                // Settled states cost nothing until a target changes
+                if (state.hoverAnim == targetHover && state.activeAnim == targetActive &&
+                    state.selectedAnim == targetSelected && state.clickAnim == 0.0f)
+                    return;
+
+                s_batch.states.push_back(&state);
+                s_batch.lerpFactor.push_back(lerpFactor);
+                s_batch.hoverTarget.push_back(targetHover);
+                s_batch.activeTarget.push_back(targetActive);
+                s_batch.selectedTarget.push_back(targetSelected);
+                return;
+            }
+
+            float t = lerpFactor;
+            state.hoverAnim += (targetHover - state.hoverAnim) * t;
+            state.activeAnim += (targetActive - state.activeAnim) * t;
+            state.selectedAnim += (targetSelected - state.selectedAnim) * t;
 
             // Decay click animation
             if (state.clickAnim > 0.0f)
             {
-                state.clickAnim -= dt * 3.0f;
+                state.clickAnim -= frame.dt * ClickDecayRate;
                 if (state.clickAnim < 0.0f) state.clickAnim = 0.0f;
             }
+
+            if (!IsSettled(state.hoverAnim, targetHover) || !IsSettled(state.activeAnim, targetActive) ||
+                !IsSettled(state.selectedAnim, targetSelected) || state.clickAnim > 0.0f)
+                RequestRedraw();
+        }
+
+        void SetBatchedUpdate(bool enabled)
+        {
+            if (s_batchedUpdate && !enabled)
+                UpdateBatch();
+            s_batchedUpdate = enabled;
+        }
+
+        bool IsBatchedUpdate()
+        {
+            return s_batchedUpdate;
+        }
+
+        void UpdateBatch()
+        {
+            UpdateSpringBatch();
+
+            StateBatch& batch = s_batch;
+            size_t count = batch.states.size();
+            batch.lastCount = count;
+            if (count == 0)
+                return;
+
+            // Advanced values are first drawn next frame
+            RequestRedraw();
+
+            // Gather current values (widgets may have written them after recording)
+            batch.hover.resize(count);
+            batch.active.resize(count);
+            batch.selected.resize(count);
+            batch.click.resize(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                const WidgetState* state = batch.states[i];
+                batch.hover[i] = state->hoverAnim;
+                batch.active[i] = state->activeAnim;
+                batch.selected[i] = state->selectedAnim;
+                batch.click[i] = state->clickAnim;
+            }
+
+            AdvanceLanes(batch.hover.data(), batch.hoverTarget.data(), batch.lerpFactor.data(), count);
+            AdvanceLanes(batch.active.data(), batch.activeTarget.data(), batch.lerpFactor.data(), count);
+            AdvanceLanes(batch.selected.data(), batch.selectedTarget.data(), batch.lerpFactor.data(), count);
+            DecayLanes(batch.click.data(), GetDeltaTime() * ClickDecayRate, count);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                WidgetState* state = batch.states[i];
+                state->hoverAnim = batch.hover[i];
+                state->activeAnim = batch.active[i];
+                state->selectedAnim = batch.selected[i];
+                state->clickAnim = batch.click[i];
+            }
+
+            batch.Clear();
+        }
+
+        size_t GetBatchedStateCount()
+        {
+            return s_batch.lastCount;
+        }
+
+        // =============================================
+        // Springs
+        // =============================================
+
+        float UpdateSpring(SpringChannel& channel, float target, const SpringParams& params)
+        {
+            if (!channel.initialized)
+            {
+                channel.value = target;
+                channel.velocity = 0.0f;
+                channel.initialized = true;
+            }
+            channel.target = target;
+
+            // At rest on the target: nothing to step
+            if (channel.value == target && channel.velocity == 0.0f)
+                return channel.value;
+
+            FrameCache& frame = GetFrameCache();
+            SpringStep step = frame.springSteps.Get(params, frame.dt);
+
+            if (s_batchedUpdate)
+            {
+                s_springBatch.Record(channel, step);
+                return channel.value;
+            }
+
+            float offset = channel.value - target;
+            StepSpringLanes(&offset, &channel.velocity, &step.a, &step.b, &step.c, &step.d, 1);
+            channel.value = target + offset;
+            if (offset != 0.0f || channel.velocity != 0.0f)
+                RequestRedraw();
+            return channel.value;
+        }
+
+        float Spring(ImGuiID id, float target, const SpringParams& params, int channel)
+        {
+            IM_ASSERT(channel >= 0 && channel < 4 && "EFIGUI: spring channel out of range (0-3)");
+            WidgetStore& store = GetWidgetStore();
+            WidgetSprings& springs = store.GetSide<WidgetSprings>(store.Get(id));
+            return UpdateSpring(springs.channels[channel], target, params);
+        }
+
+        // =============================================
+        // Redraw Tracking
+        // =============================================
+
+        void RequestRedraw(float delaySeconds)
+        {
+            if (delaySeconds < s_pendingRedrawDelay)
+                s_pendingRedrawDelay = delaySeconds > 0.0f ? delaySeconds : 0.0f;
+        }
+
+        float GetRedrawDelay()
+        {
+            return s_publishedRedrawDelay;
+        }
+
+        void PublishRedrawState()
+        {
+            s_publishedRedrawDelay = s_pendingRedrawDelay;
+            s_pendingRedrawDelay = FLT_MAX;
         }
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "imgui.h"
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 
 namespace EFIGUI
 {
@@ -22,15 +23,26 @@ namespace EFIGUI
         };
 
         // Get or create widget state for a given ID
+        // States live in the current context's WidgetStore; the reference stays
+        // valid until the state is pruned or cleared.
         WidgetState& GetState(ImGuiID id);
 
-        // Clear all cached states (call on frame start if needed)
+        // Number of cached states and the memory they hold
+        size_t GetStateCount();
+        size_t GetStateMemoryBytes();
+
+        // Clear all cached states, including component side tables
+        // (call on frame start if needed)
         void ClearStates();
 
         // Prune stale widget states that haven't been updated recently
         // maxIdleFrames: Number of frames after which unused states are pruned
         void PruneStaleStates(int maxIdleFrames = 60);
 
+        // Examine a bounded slice of the states per call, completing a full
+        // sweep every WidgetStore::PruneSweepFrames calls (called by EFIGUI::BeginFrame)
+        void PruneStaleStatesIncremental(int maxIdleFrames = 60);
+
         // =============================================
         // Easing Functions
         // =============================================
@@ -47,12 +59,16 @@ namespace EFIGUI
         float EaseInQuad(float t);        // Accelerating
         float EaseInOutQuad(float t);     // Smooth in-out
         float EaseOutBack(float t);       // Overshoot
-        float EaseOutElastic(float t);    // Bouncy
+        float EaseOutElastic(float t);    // Bouncy (table lookup within [0, 1], error < 2e-4)
 
         // =============================================
         // Periodic Functions
         // =============================================
 
+        // These are pure functions of time: widgets that draw with them
+        // should also call RequestRedraw() while the effect is visible.
+        // Pulse/Breathe/Sweep results are memoized per frame by frequency.
+
         // Pulse effect (0 to 1 oscillation)
         float Pulse(float frequency = 1.0f);
 
@@ -140,13 +156,106 @@ namespace EFIGUI
         // Utility
         // =============================================
 
-        // Get current time for animations
+        // Get current time for animations (from the context's time source)
         float GetTime();
 
-        // Get delta time
+        // Get delta time (from the context's time source)
         float GetDeltaTime();
 
         // Update widget state animations
+        // In batched mode this only records the targets (see SetBatchedUpdate).
         void UpdateWidgetState(WidgetState& state, bool isHovered, bool isActive, bool isSelected, float speed = 8.0f);
+
+        // =============================================
+        // Springs
+        // =============================================
+        // Damped spring channels stepped with the closed-form solution of
+        // x'' = -w^2 x - 2 zeta w x', so the motion is the same at 30 and 240 fps
+        // and stays stable under uneven DeltaTime. Each frame's step is a 2x2
+        // linear map computed once per distinct SpringParams; channels advance
+        // immediately, or in the vectorized EndFrame pass in batched mode (a
+        // caller-owned channel must then outlive the frame, and a channel
+        // updated twice in a frame is still stepped once). Channels at rest on
+        // their target are not stepped.
+
+        struct SpringParams
+        {
+            float frequency = 4.0f;     // Natural frequency in Hz (higher = snappier)
+            float damping = 1.0f;       // Damping ratio: 1 = critical, < 1 = overshoot (clamped to [0.05, 1])
+        };
+
+        struct SpringChannel
+        {
+            float value = 0.0f;
+            float velocity = 0.0f;
+            float target = 0.0f;
+            bool initialized = false;   // First update snaps to the target
+            uint32_t batchIndex = UINT32_MAX;   // Lane in this frame's batch (batched mode)
+        };
+
+        // Set the channel's target and advance it; returns the current value
+        float UpdateSpring(SpringChannel& channel, float target, const SpringParams& params = {});
+
+        // Spring stored in the widget's WidgetStore entry (channel 0-3)
+        float Spring(ImGuiID id, float target, const SpringParams& params = {}, int channel = 0);
+
+        // =============================================
+        // Time Source
+        // =============================================
+        // GetTime/GetDeltaTime, and everything built on them (widget states,
+        // Lerp, periodic effects, marquee sweep, cooldown overlay, Drag change
+        // feedback), read the current ImGui context's animation clock. Use
+        // FixedStep or Manual for reproducible benchmarks, captures and replays.
+
+        enum class TimeSource
+        {
+            Real,       // ImGui::GetTime() / io.DeltaTime (default)
+            FixedStep,  // Advances by fixedStep every ImGui frame
+            Manual      // Advances only through AdvanceClock()
+        };
+
+        // Select the time source for the current ImGui context
+        // FixedStep/Manual restart the clock at startTime.
+        void SetTimeSource(TimeSource source, float fixedStep = 1.0f / 60.0f, double startTime = 0.0);
+        TimeSource GetTimeSource();
+
+        // Manual mode: advance the clock; the next frame sees the sum of the
+        // advances as its time step
+        void AdvanceClock(float seconds);
+
+        // =============================================
+        // Batched Update
+        // =============================================
+        // When enabled, UpdateWidgetState records hover/active/selected targets
+        // instead of interpolating, and EndFrame advances every recorded state in
+        // one vectorized pass. States already at their targets are not recorded.
+        // Animated values therefore lag one frame behind the scalar path.
+
+        void SetBatchedUpdate(bool enabled);
+        bool IsBatchedUpdate();
+
+        // Advance all recorded states and springs (called by EFIGUI::EndFrame)
+        void UpdateBatch();
+
+        // States advanced by the last UpdateBatch
+        size_t GetBatchedStateCount();
+
+        // =============================================
+        // Redraw Tracking
+        // =============================================
+        // Widget states and Lerp report while they are still converging; effects
+        // that animate continuously request a redraw each frame they are visible.
+        // EndFrame publishes the result for EFIGUI::NeedsRedraw/NextAnimationDeadline.
+
+        // Request another frame within delaySeconds (0 = next frame)
+        // Call from custom widgets animated with Pulse/Breathe/Sweep/Shimmer or timers.
+        void RequestRedraw(float delaySeconds = 0.0f);
+
+        // Earliest request of the last published frame (FLT_MAX = none)
+        float GetRedrawDelay();
+
+        // Publish this frame's requests and start collecting the next frame's
+        // (called by EFIGUI::EndFrame)
+        void PublishRedrawState();
     }
 }
@@ -0,0 +1,57 @@
+#pragma once
+#include "Animation.h"
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        // =============================================
+        // Animation Clock
+        // =============================================
+        // State behind GetTime/GetDeltaTime, one per ImGui context (StyleSystem
+        // component state). The clock advances at most once per ImGui frame:
+        // a host that switches contexts within a frame (A, B, A) reads A's
+        // clock again without stepping it twice.
+
+        struct Clock
+        {
+            TimeSource source = TimeSource::Real;
+            float fixedStep = 1.0f / 60.0f;
+            double time = 0.0;
+            float dt = 0.0f;
+            double pendingAdvance = 0.0;   // Manual: AdvanceClock sum since the last frame
+            bool started = false;          // FixedStep: first frame stays at the start time
+            int lastFrame = -1;            // ImGui frame the clock last advanced in
+
+            // Advance for the given ImGui frame (realTime / realDelta feed
+            // TimeSource::Real). Returns false, leaving time and dt unchanged,
+            // if the clock already advanced in this frame.
+            bool Tick(int frame, double realTime, float realDelta)
+            {
+                if (frame == lastFrame)
+                    return false;
+                lastFrame = frame;
+
+                switch (source)
+                {
+                case TimeSource::Real:
+                    time = realTime;
+                    dt = realDelta;
+                    break;
+                case TimeSource::FixedStep:
+                    if (started)
+                        time += fixedStep;
+                    started = true;
+                    dt = fixedStep;
+                    break;
+                case TimeSource::Manual:
+                    time += pendingAdvance;
+                    dt = (float)pendingAdvance;
+                    pendingAdvance = 0.0;
+                    break;
+                }
+                return true;
+            }
+        };
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "Animation.h"
+#include <cmath>
+#include <vector>
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        // =============================================
+        // Spring Step
+        // =============================================
+        // One frame's closed-form spring step as a linear map on the offset
+        // from the target x and the velocity v:
+        //   x' = a*x + b*v,  v' = c*x + d*v
+        // Composing the steps of n frames of dt equals the step of n*dt, which
+        // is what keeps springs frame-rate independent.
+
+        struct SpringStep
+        {
+            float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f;
+        };
+
+        inline SpringStep ComputeSpringStep(float frequency, float damping, float dt)
+        {
+            SpringStep step;
+            if (dt <= 0.0f || frequency <= 0.0f)
+                return step;
+
+            float omega = 2.0f * 3.14159f * frequency;
+            float zeta = damping < 0.05f ? 0.05f : (damping > 1.0f ? 1.0f : damping);
+
+            if (zeta > 0.9999f)
+            {
+                // Critically damped: x(t) = (x0 + (v0 + w x0) t) e^(-w t)
+                float e = std::exp(-omega * dt);
+                step.a = (1.0f + omega * dt) * e;
+                step.b = dt * e;
+                step.c = -omega * omega * dt * e;
+                step.d = (1.0f - omega * dt) * e;
+            }
+            else
+            {
+                // Under-damped: decaying oscillation at wd = w sqrt(1 - zeta^2)
+                float omegaD = omega * std::sqrt(1.0f - zeta * zeta);
+                float e = std::exp(-zeta * omega * dt);
+                float cs = std::cos(omegaD * dt);
+                float sn = std::sin(omegaD * dt);
+                float ratio = zeta * omega / omegaD;
+                step.a = e * (cs + ratio * sn);
+                step.b = e * sn / omegaD;
+                step.c = -e * (omega * omega / omegaD) * sn;
+                step.d = e * (cs - ratio * sn);
+            }
+            return step;
+        }
+
+        // =============================================
+        // Spring Batch
+        // =============================================
+        // Spring channels recorded this frame in batched mode, with their step
+        // coefficients (structure of arrays, like the widget state batch).
+        // A channel updated more than once in a frame keeps one lane, with the
+        // latest step, so it is stepped once.
+
+        struct SpringBatch
+        {
+            std::vector<SpringChannel*> channels;
+            std::vector<float> a, b, c, d;
+
+            // Scratch for offsets from target and velocities
+            std::vector<float> offset;
+            std::vector<float> velocity;
+
+            void Record(SpringChannel& channel, const SpringStep& step)
+            {
+                // batchIndex is only trusted if it still names this channel:
+                // the batch is cleared every frame
+                size_t lane = channel.batchIndex;
+                if (lane >= channels.size() || channels[lane] != &channel)
+                {
+                    lane = channels.size();
+                    channel.batchIndex = static_cast<uint32_t>(lane);
+                    channels.push_back(&channel);
+                    a.push_back(0.0f);
+                    b.push_back(0.0f);
+                    c.push_back(0.0f);
+                    d.push_back(0.0f);
+                }
+                a[lane] = step.a;
+                b[lane] = step.b;
+                c[lane] = step.c;
+                d[lane] = step.d;
+            }
+
+            void Clear()
+            {
+                channels.clear();
+                a.clear();
+                b.clear();
+                c.clear();
+                d.clear();
+            }
+        };
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include <cmath>
+
+namespace EFIGUI
+{
+    // =============================================
+    // Series Decimation
+    // =============================================
+    // Reduce a long series to a few points per pixel column before it is
+    // tessellated. Both reducers take a sampler, sample(i) -> float for the
+    // i-th logical sample in [0, count), so ring-buffer offsets and strides are
+    // resolved by the caller. Output points are (sample index, value) pairs in
+    // increasing index order.
+
+    // Min/max envelope: for each of `buckets` equal runs of samples, emit the
+    // minimum and maximum in the order they occur (one point if they coincide).
+    // Preserves every spike; writes at most 2 * buckets points.
+    template<typename Sampler>
+    int DecimateMinMax(Sampler sample, int count, int buckets, float* outIndex, float* outValue)
+    {
+        if (count <= 0 || buckets <= 0)
+            return 0;
+        if (buckets > count)
+            buckets = count;
+
+        int written = 0;
+        for (int b = 0; b < buckets; b++)
+        {
+            const int begin = (int)((long long)count * b / buckets);
+            const int end = (int)((long long)count * (b + 1) / buckets);
+
+            int minIdx = begin, maxIdx = begin;
+            float minVal = sample(begin), maxVal = minVal;
+            for (int i = begin + 1; i < end; i++)
+            {
+                float v = sample(i);
+                if (v < minVal) { minVal = v; minIdx = i; }
+                if (v > maxVal) { maxVal = v; maxIdx = i; }
+            }
+
+            const int firstIdx = minIdx < maxIdx ? minIdx : maxIdx;
+            const int secondIdx = minIdx < maxIdx ? maxIdx : minIdx;
+            outIndex[written] = (float)firstIdx;
+            outValue[written] = firstIdx == minIdx ? minVal : maxVal;
+            written++;
+            if (secondIdx != firstIdx)
+            {
+                outIndex[written] = (float)secondIdx;
+                outValue[written] = secondIdx == maxIdx ? maxVal : minVal;
+                written++;
+            }
+        }
+        return written;
+    }
+
+    // Largest-Triangle-Three-Buckets: keep the first and last samples and, from
+    // each of threshold - 2 buckets in between, the sample forming the largest
+    // triangle with the previous pick and the next bucket's average. Keeps the
+    // visual shape with exactly `threshold` points (raised to 3; all samples if
+    // count <= threshold).
+    template<typename Sampler>
+    int DecimateLTTB(Sampler sample, int count, int threshold, float* outIndex, float* outValue)
+    {
+        if (count <= 0)
+            return 0;
+        if (threshold < 3)
+            threshold = 3;
+        if (threshold >= count)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                outIndex[i] = (float)i;
+                outValue[i] = sample(i);
+            }
+            return count;
+        }
+
+        const double bucketSize = (double)(count - 2) / (threshold - 2);
+        int written = 0;
+
+        int prevIdx = 0;
+        float prevVal = sample(0);
+        outIndex[written] = 0.0f;
+        outValue[written] = prevVal;
+        written++;
+
+        for (int b = 0; b < threshold - 2; b++)
+        {
+            // Average of the next bucket (the last sample for the final bucket)
+            const int nextBegin = (int)((b + 1) * bucketSize) + 1;
+            int nextEnd = (int)((b + 2) * bucketSize) + 1;
+            if (nextEnd > count) nextEnd = count;
+            double avgX = 0.0, avgY = 0.0;
+            if (nextBegin < nextEnd)
+            {
+                for (int i = nextBegin; i < nextEnd; i++)
+                {
+                    avgX += i;
+                    avgY += sample(i);
+                }
+                avgX /= (nextEnd - nextBegin);
+                avgY /= (nextEnd - nextBegin);
+            }
+            else
+            {
+                avgX = count - 1;
+                avgY = sample(count - 1);
+            }
+
+            // Pick the sample in this bucket with the largest triangle area
+            const int begin = (int)(b * bucketSize) + 1;
+            int end = (int)((b + 1) * bucketSize) + 1;
+            if (end > count - 1) end = count - 1;
+
+            int bestIdx = begin;
+            float bestVal = sample(begin);
+            double bestArea = -1.0;
+            for (int i = begin; i < end; i++)
+            {
+                const float v = sample(i);
+                const double area = std::fabs((prevIdx - avgX) * ((double)v - prevVal) -
+                                              ((double)prevIdx - i) * (avgY - prevVal));
+                if (area > bestArea)
+                {
+                    bestArea = area;
+                    bestIdx = i;
+                    bestVal = v;
+                }
+            }
+
+            outIndex[written] = (float)bestIdx;
+            outValue[written] = bestVal;
+            written++;
+            prevIdx = bestIdx;
+            prevVal = bestVal;
+        }
+
+        outIndex[written] = (float)(count - 1);
+        outValue[written] = sample(count - 1);
+        written++;
+        return written;
+    }
+}
@@ -3,7 +3,10 @@
 #include "Animation.h"
 #include "Layer.h"
 #include "EFIGUI.h"
+#include "Style.h"
+#include "imgui_internal.h"
 #include <cmath>
+#include <vector>
 
 namespace EFIGUI
 {
@@ -13,34 +16,37 @@ namespace EFIGUI
         // Helper Functions
         // =============================================
 
-        // Calculate path points along a rounded rectangle perimeter
-        // Returns points in clockwise order starting from top-left corner
+        // Calculate path points along a rounded rectangle perimeter at the origin
+        // Points are in clockwise order starting from top-left corner
         static void CalculateRoundedRectPath(
-            ImVec2 pos,
             ImVec2 size,
             float rounding,
             int numSegments,
             int cornerSegments,
+            int minEdgeSegments,
             std::vector<ImVec2>& outPoints)
         {
             using namespace DrawLocal;
-            const auto& d = Theme::Draw();
 
             float straightW = size.x - 2 * rounding;
             float straightH = size.y - 2 * rounding;
             float cornerArc = Pi * rounding * 0.5f;
             float perimeter = 2 * straightW + 2 * straightH + 4 * cornerArc;
 
+            // Edge subdivision (bottom/left mirror top/right)
+            int topSegments = (int)(numSegments * straightW / perimeter);
+            if (topSegments < minEdgeSegments) topSegments = minEdgeSegments;
+            int rightSegments = (int)(numSegments * straightH / perimeter);
+            if (rightSegments < minEdgeSegments) rightSegments = minEdgeSegments;
+
             outPoints.clear();
-            outPoints.reserve(numSegments + 1);
+            outPoints.reserve(2 * topSegments + 1 + 2 * rightSegments + 4 * cornerSegments);
 
             // Top edge (left to right)
-            int topSegments = (int)(numSegments * straightW / perimeter);
-            if (topSegments < d.marqueeMinEdgeSegments) topSegments = d.marqueeMinEdgeSegments;
             for (int i = 0; i <= topSegments; i++)
             {
                 float t = (float)i / topSegments;
-                outPoints.push_back(ImVec2(pos.x + rounding + t * straightW, pos.y));
+                outPoints.push_back(ImVec2(rounding + t * straightW, 0.0f));
             }
 
             // Top-right corner
@@ -48,17 +54,15 @@ namespace EFIGUI
             {
                 float angle = -Pi * 0.5f + (float)i / cornerSegments * Pi * 0.5f;
                 outPoints.push_back(ImVec2(
-                    pos.x + size.x - rounding + cosf(angle) * rounding,
-                    pos.y + rounding + sinf(angle) * rounding));
+                    size.x - rounding + cosf(angle) * rounding,
+                    rounding + sinf(angle) * rounding));
             }
 
             // Right edge (top to bottom)
-            int rightSegments = (int)(numSegments * straightH / perimeter);
-            if (rightSegments < d.marqueeMinEdgeSegments) rightSegments = d.marqueeMinEdgeSegments;
             for (int i = 1; i <= rightSegments; i++)
             {
                 float t = (float)i / rightSegments;
-                outPoints.push_back(ImVec2(pos.x + size.x, pos.y + rounding + t * straightH));
+                outPoints.push_back(ImVec2(size.x, rounding + t * straightH));
             }
 
             // Bottom-right corner
@@ -66,15 +70,15 @@ namespace EFIGUI
             {
                 float angle = (float)i / cornerSegments * Pi * 0.5f;
                 outPoints.push_back(ImVec2(
-                    pos.x + size.x - rounding + cosf(angle) * rounding,
-                    pos.y + size.y - rounding + sinf(angle) * rounding));
+                    size.x - rounding + cosf(angle) * rounding,
+                    size.y - rounding + sinf(angle) * rounding));
             }
 
             // Bottom edge (right to left)
             for (int i = 1; i <= topSegments; i++)
             {
                 float t = (float)i / topSegments;
-                outPoints.push_back(ImVec2(pos.x + size.x - rounding - t * straightW, pos.y + size.y));
+                outPoints.push_back(ImVec2(size.x - rounding - t * straightW, size.y));
             }
 
             // Bottom-left corner
@@ -82,15 +86,15 @@ namespace EFIGUI
             {
                 float angle = Pi * 0.5f + (float)i / cornerSegments * Pi * 0.5f;
                 outPoints.push_back(ImVec2(
-                    pos.x + rounding + cosf(angle) * rounding,
-                    pos.y + size.y - rounding + sinf(angle) * rounding));
+                    rounding + cosf(angle) * rounding,
+                    size.y - rounding + sinf(angle) * rounding));
             }
 
             // Left edge (bottom to top)
             for (int i = 1; i <= rightSegments; i++)
             {
                 float t = (float)i / rightSegments;
-                outPoints.push_back(ImVec2(pos.x, pos.y + size.y - rounding - t * straightH));
+                outPoints.push_back(ImVec2(0.0f, size.y - rounding - t * straightH));
             }
 
             // Top-left corner
@@ -98,15 +102,104 @@ namespace EFIGUI
             {
                 float angle = Pi + (float)i / cornerSegments * Pi * 0.5f;
                 outPoints.push_back(ImVec2(
-                    pos.x + rounding + cosf(angle) * rounding,
-                    pos.y + rounding + sinf(angle) * rounding));
+                    rounding + cosf(angle) * rounding,
+                    rounding + sinf(angle) * rounding));
+            }
+        }
+
+        // Marquee paths by (size, rounding, segment counts), relative to the
+        // rect's top-left corner. The geometry only changes when a button
+        // resizes, so a hovered button reuses its path every frame.
+        struct MarqueePathCache
+        {
+            static constexpr size_t MaxEntries = 32;
+
+            struct Entry
+            {
+                ImVec2 size;
+                float rounding;
+                int numSegments;
+                int cornerSegments;
+                int minEdgeSegments;
+                int lastUsedFrame;
+                std::vector<ImVec2> points;
+            };
+
+            std::vector<Entry> entries;
+        };
+
+        static const std::vector<ImVec2>& GetMarqueePath(ImVec2 size, float rounding)
+        {
+            const auto& d = Theme::Draw();
+            auto& cache = StyleSystem::GetComponentState<MarqueePathCache>();
+            const int frame = ImGui::GetFrameCount();
+
+            for (auto& entry : cache.entries)
+            {
+                if (entry.size.x == size.x && entry.size.y == size.y && entry.rounding == rounding &&
+                    entry.numSegments == d.marqueeNumSegments && entry.cornerSegments == d.marqueeCornerSegments &&
+                    entry.minEdgeSegments == d.marqueeMinEdgeSegments)
+                {
+                    entry.lastUsedFrame = frame;
+                    return entry.points;
+                }
             }
+
+            // Miss: take a new slot, or reuse the least recently used one
+            MarqueePathCache::Entry* slot = nullptr;
+            if (cache.entries.size() < MarqueePathCache::MaxEntries)
+            {
+                slot = &cache.entries.emplace_back();
+            }
+            else
+            {
+                slot = &cache.entries[0];
+                for (auto& entry : cache.entries)
+                {
+                    if (entry.lastUsedFrame < slot->lastUsedFrame)
+                        slot = &entry;
+                }
+            }
+
+            slot->size = size;
+            slot->rounding = rounding;
+            slot->numSegments = d.marqueeNumSegments;
+            slot->cornerSegments = d.marqueeCornerSegments;
+            slot->minEdgeSegments = d.marqueeMinEdgeSegments;
+            slot->lastUsedFrame = frame;
+            CalculateRoundedRectPath(size, rounding, d.marqueeNumSegments, d.marqueeCornerSegments, d.marqueeMinEdgeSegments, slot->points);
+            return slot->points;
+        }
+
+        // Alpha of path point i with quadratic falloff from the sweep position
+        static int MarqueeAlpha(int i, int totalPoints, float sweepPos, float sweepLengthFrac, float hoverAnim, int minAlpha)
+        {
+            float segPos = (float)i / totalPoints;
+
+            // Calculate distance from sweep position (wrapping around)
+            float dist1 = fabsf(segPos - sweepPos);
+            float dist2 = fabsf(segPos - sweepPos + 1.0f);
+            float dist3 = fabsf(segPos - sweepPos - 1.0f);
+            float dist = dist1;
+            if (dist2 < dist) dist = dist2;
+            if (dist3 < dist) dist = dist3;
+
+            // Convert distance to alpha with quadratic falloff
+            float normalizedDist = dist / sweepLengthFrac;
+            float alpha = 1.0f - normalizedDist;
+            if (alpha < 0.0f) alpha = 0.0f;
+            alpha = alpha * alpha;
+
+            int finalAlpha = (int)(alpha * 255 * hoverAnim);
+            if (finalAlpha < minAlpha) finalAlpha = (int)(minAlpha * hoverAnim);
+            return finalAlpha;
         }
 
         // Draw marquee segments with alpha falloff based on sweep position
         static void DrawMarqueeSegments(
             Layer targetLayer,
-            const std::vector<ImVec2>& pathPoints,
+            const ImVec2* pathPoints,
+            int totalPoints,
             int r, int g, int b,
             float sweepPos,
             float sweepLengthFrac,
@@ -115,47 +208,307 @@ namespace EFIGUI
         {
             const auto& d = Theme::Draw();
 
-            int totalPoints = (int)pathPoints.size();
             for (int i = 0; i < totalPoints; i++)
             {
-                float segPos = (float)i / totalPoints;
+                int alpha = MarqueeAlpha(i, totalPoints, sweepPos, sweepLengthFrac, hoverAnim, d.marqueeMinAlpha);
+                ImU32 segColor = IM_COL32(r, g, b, alpha);
 
-                // Calculate distance from sweep position (wrapping around)
-                float dist1 = fabsf(segPos - sweepPos);
-                float dist2 = fabsf(segPos - sweepPos + 1.0f);
-                float dist3 = fabsf(segPos - sweepPos - 1.0f);
-                float dist = dist1;
-                if (dist2 < dist) dist = dist2;
-                if (dist3 < dist) dist = dist3;
+                int nextIdx = (i + 1) % totalPoints;
+                Layers().AddLine(targetLayer, pathPoints[i], pathPoints[nextIdx], segColor, lineThickness);
+            }
+        }
 
-                // Convert distance to alpha with quadratic falloff
-                float normalizedDist = dist / sweepLengthFrac;
-                float alpha = 1.0f - normalizedDist;
-                if (alpha < 0.0f) alpha = 0.0f;
-                alpha = alpha * alpha;
+        // Draw the whole marquee as one closed polyline with per-vertex alpha
+        static void DrawMarqueePolyline(
+            Layer targetLayer,
+            const ImVec2* pathPoints,
+            int totalPoints,
+            int r, int g, int b,
+            float sweepPos,
+            float sweepLengthFrac,
+            float lineThickness,
+            float hoverAnim)
+        {
+            const auto& d = Theme::Draw();
 
-                int finalAlpha = (int)(alpha * 255 * hoverAnim);
-                if (finalAlpha < d.marqueeMinAlpha) finalAlpha = (int)(d.marqueeMinAlpha * hoverAnim);
+            ImU32* colors = GetFrameArena().AllocateArray<ImU32>(totalPoints);
+            for (int i = 0; i < totalPoints; i++)
+                colors[i] = IM_COL32(r, g, b, MarqueeAlpha(i, totalPoints, sweepPos, sweepLengthFrac, hoverAnim, d.marqueeMinAlpha));
 
-                ImU32 segColor = IM_COL32(r, g, b, finalAlpha);
+            Layers().AddPolylineMultiColor(targetLayer, pathPoints, colors, totalPoints, lineThickness, true);
+        }
 
-                int nextIdx = (i + 1) % totalPoints;
-                Layers().AddLine(targetLayer, pathPoints[i], pathPoints[nextIdx], segColor, lineThickness);
+        // Segments per rounded corner for a feathered quality (0 = Layered)
+        static int GlowQualitySegments(GlowQuality quality)
+        {
+            switch (quality)
+            {
+            case GlowQuality::Low:    return 4;
+            case GlowQuality::Medium: return 8;
+            case GlowQuality::High:   return 16;
+            default:                  return 0;
             }
         }
 
+        // Alpha where all layers of a glow stack overlap: 1 - prod(1 - a_i)
+        static float StackedGlowAlpha(float intensity, float layerAlpha, int layerCount)
+        {
+            float transmit = 1.0f;
+            for (int i = 1; i <= layerCount; i++)
+                transmit *= 1.0f - intensity * layerAlpha * (1.0f - (float)i / (layerCount + 1.0f));
+            return 1.0f - transmit;
+        }
+
+        static ImU32 WithAlpha(ImU32 color, float alpha)
+        {
+            if (alpha < 0.0f) alpha = 0.0f;
+            if (alpha > 1.0f) alpha = 1.0f;
+            return (color & ~IM_COL32_A_MASK) | ((ImU32)(alpha * 255.0f) << IM_COL32_A_SHIFT);
+        }
+
+        // Ring between center + dir * inner and center + dir * outer for each
+        // sample (closed loop), optionally fanning the inner loop (convex)
+        static void AddFeatheredRing(ImDrawList* draw, const ImVec2* centers, const ImVec2* dirs, int count,
+                                     float inner, float outer, ImU32 color, bool filled)
+        {
+            const ImVec2 uv = draw->_Data->TexUvWhitePixel;
+            const ImU32 transparent = color & ~IM_COL32_A_MASK;
+            const int idxCount = count * 6 + (filled ? (count - 2) * 3 : 0);
+
+            draw->PrimReserve(idxCount, count * 2);
+            const unsigned int base = draw->_VtxCurrentIdx;
+
+            for (int i = 0; i < count; i++)
+            {
+                draw->PrimWriteVtx(ImVec2(centers[i].x + dirs[i].x * inner, centers[i].y + dirs[i].y * inner), uv, color);
+                draw->PrimWriteVtx(ImVec2(centers[i].x + dirs[i].x * outer, centers[i].y + dirs[i].y * outer), uv, transparent);
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                const unsigned int a = base + i * 2;
+                const unsigned int b = base + ((i + 1) % count) * 2;
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)b);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)(a + 1));
+            }
+
+            if (filled)
+            {
+                for (int i = 1; i < count - 1; i++)
+                {
+                    draw->PrimWriteIdx((ImDrawIdx)base);
+                    draw->PrimWriteIdx((ImDrawIdx)(base + i * 2));
+                    draw->PrimWriteIdx((ImDrawIdx)(base + (i + 1) * 2));
+                }
+            }
+        }
+
+        static ImU32 LerpColor(ImU32 a, ImU32 b, float t)
+        {
+            ImU32 result = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                float ca = (float)((a >> shift) & 0xFF);
+                float cb = (float)((b >> shift) & 0xFF);
+                result |= (ImU32)(ca + (cb - ca) * t + 0.5f) << shift;
+            }
+            return result;
+        }
+
+        // Rounded rect filled as one convex fan with bilinear corner colors
+        // (top-left, top-right, bottom-right, bottom-left) and a half-pixel
+        // anti-aliasing fringe, instead of AddRectFilledMultiColor's square
+        // corners plus patch-up fills
+        static void AddRoundedGradientRect(ImDrawList* draw, ImVec2 min, ImVec2 max,
+                                           ImU32 colTL, ImU32 colTR, ImU32 colBR, ImU32 colBL,
+                                           float rounding, ImDrawFlags flags)
+        {
+            using namespace DrawLocal;
+            constexpr int MaxCornerSegments = 16;
+            constexpr float Fringe = 0.5f;
+
+            float width = max.x - min.x, height = max.y - min.y;
+            if (width <= 0.0f || height <= 0.0f)
+                return;
+
+            if ((flags & ImDrawFlags_RoundCornersAll) == 0)
+                flags |= ImDrawFlags_RoundCornersAll;
+            if (flags & ImDrawFlags_RoundCornersNone)
+                rounding = 0.0f;
+            float maxRounding = (width < height ? width : height) * 0.5f;
+            if (rounding > maxRounding) rounding = maxRounding;
+
+            int segments = (int)(rounding * 0.5f) + 3;
+            if (segments > MaxCornerSegments) segments = MaxCornerSegments;
+
+            // Corners clockwise from top-right, with the flag that rounds each
+            // and the direction a square corner's fringe extends
+            struct Corner { ImVec2 point; ImVec2 sign; ImDrawFlags flag; };
+            const Corner corners[4] = {
+                { ImVec2(max.x, min.y), ImVec2( 1.0f, -1.0f), ImDrawFlags_RoundCornersTopRight },
+                { ImVec2(max.x, max.y), ImVec2( 1.0f,  1.0f), ImDrawFlags_RoundCornersBottomRight },
+                { ImVec2(min.x, max.y), ImVec2(-1.0f,  1.0f), ImDrawFlags_RoundCornersBottomLeft },
+                { ImVec2(min.x, min.y), ImVec2(-1.0f, -1.0f), ImDrawFlags_RoundCornersTopLeft }
+            };
+
+            // Perimeter points and their outward fringe offsets
+            ImVec2 points[4 * (MaxCornerSegments + 1)];
+            ImVec2 normals[4 * (MaxCornerSegments + 1)];
+            int count = 0;
+            for (int c = 0; c < 4; c++)
+            {
+                const Corner& corner = corners[c];
+                if (rounding <= 0.0f || !(flags & corner.flag))
+                {
+                    points[count] = corner.point;
+                    normals[count] = corner.sign;       // Miter of two unit normals
+                    count++;
+                    continue;
+                }
+
+                ImVec2 center(corner.point.x - corner.sign.x * rounding, corner.point.y - corner.sign.y * rounding);
+                float start = -Pi * 0.5f + c * Pi * 0.5f;
+                for (int i = 0; i <= segments; i++)
+                {
+                    float angle = start + (float)i / segments * Pi * 0.5f;
+                    ImVec2 dir(cosf(angle), sinf(angle));
+                    points[count] = ImVec2(center.x + dir.x * rounding, center.y + dir.y * rounding);
+                    normals[count] = dir;
+                    count++;
+                }
+            }
+
+            const ImVec2 uv = draw->_Data->TexUvWhitePixel;
+            draw->PrimReserve((count - 2) * 3 + count * 6, count * 2);
+            const unsigned int base = draw->_VtxCurrentIdx;
+
+            for (int i = 0; i < count; i++)
+            {
+                float tx = (points[i].x - min.x) / width;
+                float ty = (points[i].y - min.y) / height;
+                ImU32 col = LerpColor(LerpColor(colTL, colTR, tx), LerpColor(colBL, colBR, tx), ty);
+                ImVec2 n(normals[i].x * Fringe, normals[i].y * Fringe);
+                draw->PrimWriteVtx(ImVec2(points[i].x - n.x, points[i].y - n.y), uv, col);
+                draw->PrimWriteVtx(ImVec2(points[i].x + n.x, points[i].y + n.y), uv, col & ~IM_COL32_A_MASK);
+            }
+
+            // Interior fan over the inner vertices
+            for (int i = 1; i < count - 1; i++)
+            {
+                draw->PrimWriteIdx((ImDrawIdx)base);
+                draw->PrimWriteIdx((ImDrawIdx)(base + i * 2));
+                draw->PrimWriteIdx((ImDrawIdx)(base + (i + 1) * 2));
+            }
+
+            // Fringe quads
+            for (int i = 0; i < count; i++)
+            {
+                const unsigned int a = base + i * 2;
+                const unsigned int b = base + ((i + 1) % count) * 2;
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)b);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)a);
+                draw->PrimWriteIdx((ImDrawIdx)(b + 1));
+                draw->PrimWriteIdx((ImDrawIdx)(a + 1));
+            }
+        }
+
+        // =============================================
+        // Feathered Glow Meshes
+        // =============================================
+
+        void FeatheredRect(ImDrawList* draw, ImVec2 min, ImVec2 max, ImU32 color, float rounding, float feather, bool filled, int cornerSegments)
+        {
+            using namespace DrawLocal;
+            constexpr int MaxCornerSegments = 32;
+
+            if ((color & IM_COL32_A_MASK) == 0 || max.x <= min.x || max.y <= min.y)
+                return;
+
+            if (cornerSegments < 1) cornerSegments = 1;
+            if (cornerSegments > MaxCornerSegments) cornerSegments = MaxCornerSegments;
+            float maxRounding = ((max.x - min.x) < (max.y - min.y) ? (max.x - min.x) : (max.y - min.y)) * 0.5f;
+            if (rounding > maxRounding) rounding = maxRounding;
+            if (rounding < 0.0f) rounding = 0.0f;
+
+            // Each corner arc shares its center; the ring's outer edge is the
+            // same arc at rounding + feather
+            const ImVec2 corners[4] = {
+                ImVec2(max.x - rounding, min.y + rounding),     // Top-right
+                ImVec2(max.x - rounding, max.y - rounding),     // Bottom-right
+                ImVec2(min.x + rounding, max.y - rounding),     // Bottom-left
+                ImVec2(min.x + rounding, min.y + rounding)      // Top-left
+            };
+
+            ImVec2 centers[4 * (MaxCornerSegments + 1)];
+            ImVec2 dirs[4 * (MaxCornerSegments + 1)];
+            int count = 0;
+            for (int c = 0; c < 4; c++)
+            {
+                float start = -Pi * 0.5f + c * Pi * 0.5f;
+                for (int i = 0; i <= cornerSegments; i++)
+                {
+                    float angle = start + (float)i / cornerSegments * Pi * 0.5f;
+                    centers[count] = corners[c];
+                    dirs[count] = ImVec2(cosf(angle), sinf(angle));
+                    count++;
+                }
+            }
+
+            AddFeatheredRing(draw, centers, dirs, count, rounding, rounding + feather, color, filled);
+        }
+
+        void FeatheredCircle(ImDrawList* draw, ImVec2 center, float radius, ImU32 color, float feather, bool filled, int segments)
+        {
+            using namespace DrawLocal;
+            constexpr int MaxSegments = 128;
+
+            if ((color & IM_COL32_A_MASK) == 0)
+                return;
+
+            if (segments < 8) segments = 8;
+            if (segments > MaxSegments) segments = MaxSegments;
+
+            ImVec2 centers[MaxSegments];
+            ImVec2 dirs[MaxSegments];
+            for (int i = 0; i < segments; i++)
+            {
+                float angle = (float)i / segments * 2.0f * Pi;
+                centers[i] = center;
+                dirs[i] = ImVec2(cosf(angle), sinf(angle));
+            }
+
+            AddFeatheredRing(draw, centers, dirs, segments, radius, radius + feather, color, filled);
+        }
+
         // =============================================
         // Basic Glow Effects
         // =============================================
 
-        void RectGlow(ImVec2 min, ImVec2 max, ImU32 color, float intensity, float radius)
+        void RectGlow(ImVec2 min, ImVec2 max, ImU32 color, float intensity, float radius, float rounding)
         {
             const auto& d = Theme::Draw();
 
             if (intensity < d.glowMinIntensity) return;
 
+            if (rounding < 0.0f)
+                rounding = Theme::FrameRounding();
+
             ImDrawList* draw = ImGui::GetWindowDrawList();
 
+            // One ring from the rect's edge (strongest) out to radius (transparent)
+            if (int segments = GlowQualitySegments(d.glowQuality))
+            {
+                FeatheredRect(draw, min, max, WithAlpha(color, intensity * d.glowAlphaMultiplier),
+                              rounding, radius, false, segments);
+                return;
+            }
+
             for (int i = d.glowLayerCount; i >= 1; i--)
             {
                 float expand = radius * (float)i / d.glowLayerCount;
@@ -172,26 +525,23 @@ namespace EFIGUI
                     ImVec2(min.x - expand, min.y - expand),
                     ImVec2(max.x + expand, max.y + expand),
                     layerColor,
-                    Theme::FrameRounding() + expand,
+                    rounding + expand,
                     0,
                     d.glowLineThickness
                 );
             }
         }
 
-        void RectGradientH(ImVec2 min, ImVec2 max, ImU32 left, ImU32 right, float rounding)
+        void RectGradientH(ImVec2 min, ImVec2 max, ImU32 left, ImU32 right, float rounding, ImDrawFlags flags)
         {
             ImDrawList* draw = ImGui::GetWindowDrawList();
-
-            // ImGui doesn't support gradient with rounding directly,
-            // so we use AddRectFilledMultiColor for both cases
-            draw->AddRectFilledMultiColor(min, max, left, right, right, left);
+            AddRoundedGradientRect(draw, min, max, left, right, right, left, rounding, flags);
         }
 
-        void RectGradientV(ImVec2 min, ImVec2 max, ImU32 top, ImU32 bottom, float rounding)
+        void RectGradientV(ImVec2 min, ImVec2 max, ImU32 top, ImU32 bottom, float rounding, ImDrawFlags flags)
         {
             ImDrawList* draw = ImGui::GetWindowDrawList();
-            draw->AddRectFilledMultiColor(min, max, top, top, bottom, bottom);
+            AddRoundedGradientRect(draw, min, max, top, top, bottom, bottom, rounding, flags);
         }
 
         void NeonBorder(ImVec2 min, ImVec2 max, ImU32 color, float thickness, float rounding)
@@ -201,7 +551,7 @@ namespace EFIGUI
             ImDrawList* draw = ImGui::GetWindowDrawList();
 
             // Glow layers
-            RectGlow(min, max, color, d.neonGlowIntensity, d.neonGlowRadius);
+            RectGlow(min, max, color, d.neonGlowIntensity, d.neonGlowRadius, rounding);
 
             // Main border
             draw->AddRect(min, max, color, rounding, 0, thickness);
@@ -232,6 +582,15 @@ namespace EFIGUI
             // Determine target layer
             Layer targetLayer = layer.value_or(Layers().GetConfig().defaultWidgetGlow);
 
+            // One mesh: the stack's combined alpha inside, fading out to the outermost layer
+            if (int segments = GlowQualitySegments(d.glowQuality))
+            {
+                float alpha = StackedGlowAlpha(intensity, d.glowLayersRectAlpha, layerCount);
+                Layers().AddFeatheredRect(targetLayer, pos, ImVec2(pos.x + size.x, pos.y + size.y),
+                                          IM_COL32(r, g, b, (int)(alpha * 255)), rounding, layerCount * expandBase, true, segments);
+                return;
+            }
+
             // Draw glow layers from outer to inner using deferred drawing
             for (int i = layerCount; i >= 1; i--)
             {
@@ -261,6 +620,15 @@ namespace EFIGUI
             // Determine target layer
             Layer targetLayer = layer.value_or(Layers().GetConfig().defaultWidgetGlow);
 
+            // One mesh: the stack's combined alpha inside, fading out to the outermost layer
+            if (int segments = GlowQualitySegments(d.glowQuality))
+            {
+                float alpha = StackedGlowAlpha(intensity, d.glowLayersCircleAlpha, layerCount);
+                Layers().AddFeatheredCircle(targetLayer, center, baseRadius, IM_COL32(r, g, b, (int)(alpha * 255)),
+                                            layerCount * expandBase, true, segments * 4);
+                return;
+            }
+
             // Draw glow layers from outer to inner using deferred drawing
             for (int i = layerCount; i >= 1; i--)
             {
@@ -286,17 +654,26 @@ namespace EFIGUI
                 return;
             }
 
+            // The sweep moves every frame while visible
+            Animation::RequestRedraw();
+
             // Extract RGB from color
             int r = (color >> 0) & 0xFF;
             int g = (color >> 8) & 0xFF;
             int b = (color >> 16) & 0xFF;
 
-            // Build path points along rounded rect
-            std::vector<ImVec2> pathPoints;
-            CalculateRoundedRectPath(pos, size, rounding, d.marqueeNumSegments, d.marqueeCornerSegments, pathPoints);
+            // Cached path along the rounded rect, placed at pos (scratch memory from the frame arena)
+            const std::vector<ImVec2>& path = GetMarqueePath(size, rounding);
+            int totalPoints = (int)path.size();
+            ImVec2* pathPoints = GetFrameArena().AllocateArray<ImVec2>(totalPoints);
+            for (int i = 0; i < totalPoints; i++)
+                pathPoints[i] = ImVec2(pos.x + path[i].x, pos.y + path[i].y);
 
-            // Draw marquee segments with alpha falloff
-            DrawMarqueeSegments(targetLayer, pathPoints, r, g, b, sweepPos, sweepLengthFrac, lineThickness, hoverAnim);
+            // Draw the sweep with alpha falloff
+            if (d.marqueePolyline)
+                DrawMarqueePolyline(targetLayer, pathPoints, totalPoints, r, g, b, sweepPos, sweepLengthFrac, lineThickness, hoverAnim);
+            else
+                DrawMarqueeSegments(targetLayer, pathPoints, totalPoints, r, g, b, sweepPos, sweepLengthFrac, lineThickness, hoverAnim);
         }
 
         bool GlassmorphismBg(ImVec2 pos, ImVec2 size, float rounding, float hoverAnim, bool isActive, std::optional<uint8_t> bgAlpha)
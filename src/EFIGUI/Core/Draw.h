@@ -23,14 +23,17 @@ namespace EFIGUI
         // Basic Glow Effects
         // =============================================
 
-        // Draw a rectangle with outer glow effect
-        void RectGlow(ImVec2 min, ImVec2 max, ImU32 color, float intensity = 0.5f, float radius = 8.0f);
+        // Draw a rectangle with outer glow effect (DrawTheme::glowQuality selects
+        // stacked outlines or one feathered ring)
+        // rounding: the glowed rect's corner rounding (negative = Theme::FrameRounding())
+        void RectGlow(ImVec2 min, ImVec2 max, ImU32 color, float intensity = 0.5f, float radius = 8.0f, float rounding = -1.0f);
 
-        // Draw horizontal gradient rectangle
-        void RectGradientH(ImVec2 min, ImVec2 max, ImU32 left, ImU32 right, float rounding = 0.0f);
+        // Draw horizontal gradient rectangle (one anti-aliased convex mesh)
+        // flags: ImDrawFlags_RoundCorners* selects the rounded corners (0 = all)
+        void RectGradientH(ImVec2 min, ImVec2 max, ImU32 left, ImU32 right, float rounding = 0.0f, ImDrawFlags flags = 0);
 
-        // Draw vertical gradient rectangle
-        void RectGradientV(ImVec2 min, ImVec2 max, ImU32 top, ImU32 bottom, float rounding = 0.0f);
+        // Draw vertical gradient rectangle (one anti-aliased convex mesh)
+        void RectGradientV(ImVec2 min, ImVec2 max, ImU32 top, ImU32 bottom, float rounding = 0.0f, ImDrawFlags flags = 0);
 
         // Draw a neon-style glowing border
         void NeonBorder(ImVec2 min, ImVec2 max, ImU32 color, float thickness = 2.0f, float rounding = 8.0f);
@@ -38,11 +41,25 @@ namespace EFIGUI
         // Draw centered icon/text within a rect
         void IconCentered(ImVec2 min, ImVec2 max, const char* icon, ImU32 color);
 
+        // =============================================
+        // Feathered Glow Meshes
+        // =============================================
+        // A single ring mesh: inner vertices carry the full color, outer vertices
+        // (feather pixels further out) zero alpha. One tessellation replaces a
+        // stack of glow layers. filled also covers the interior with the color.
+
+        // Rounded rect ring; cornerSegments controls tessellation per corner
+        void FeatheredRect(ImDrawList* draw, ImVec2 min, ImVec2 max, ImU32 color, float rounding, float feather, bool filled = true, int cornerSegments = 8);
+
+        // Circle ring; segments around the full circle
+        void FeatheredCircle(ImDrawList* draw, ImVec2 center, float radius, ImU32 color, float feather, bool filled = true, int segments = 32);
+
         // =============================================
         // Advanced Glow Effects
         // =============================================
 
         // Draw multiple expanding glow layers (rectangle)
+        // DrawTheme::glowQuality selects stacked shapes or one feathered mesh
         // layer: Target layer for deferred drawing (nullopt = use LayerConfig default)
         void GlowLayers(
             ImVec2 pos,
@@ -56,6 +73,7 @@ namespace EFIGUI
         );
 
         // Draw multiple expanding glow layers (circle)
+        // DrawTheme::glowQuality selects stacked shapes or one feathered mesh
         // layer: Target layer for deferred drawing (nullopt = use LayerConfig default)
         void GlowLayersCircle(
             ImVec2 center,
@@ -20,6 +20,9 @@ namespace EFIGUI
     static bool s_initialized = false;
     static std::unique_ptr<IBlurBackend> s_blurBackend = nullptr;
 
+    // Per-frame scratch memory for transient allocations
+    static FrameArena s_frameArena;
+
     // Frame lifecycle tracking for debug validation
     static int s_lastBeginFrameCount = -1;
     static int s_lastEndFrameCount = -1;
@@ -124,18 +127,18 @@ namespace EFIGUI
 
         s_lastBeginFrameCount = currentFrame;
 
+        // Release last frame's transient allocations
+        s_frameArena.Reset();
+
         // Clear deferred drawing commands from previous frame
         LayerManager::Get().BeginFrame();
 
-        // Periodically prune stale cached state (every ~1 second at 60fps)
-        static int s_pruneCounter = 0;
-        if (++s_pruneCounter >= 60)
-        {
-            s_pruneCounter = 0;
-            Animation::PruneStaleStates(60);
-            PruneSliderInputBuffers(60);
-            PruneDragValueStates(2.0f);
-        }
+        // Advance all tween tracks in one batch before widgets read them
+        Animation::UpdateTweens(Animation::GetDeltaTime());
+
+        // Prune stale widget state (animation + component side tables) a bounded
+        // slice at a time; the store is fully swept every PruneSweepFrames frames
+        GetWidgetStore().PruneIncremental(60);
     }
 
     void EndFrame(ImDrawList* targetDrawList)
@@ -151,10 +154,35 @@ namespace EFIGUI
 
         s_lastEndFrameCount = currentFrame;
 
+        // Advance widget states recorded in batched mode
+        Animation::UpdateBatch();
+
+        // Close this frame's redraw requests for NeedsRedraw/NextAnimationDeadline
+        Animation::PublishRedrawState();
+
         // Flush all deferred drawing commands in layer order
         LayerManager::Get().Flush(targetDrawList);
     }
 
+    FrameArena& GetFrameArena()
+    {
+        return s_frameArena;
+    }
+
+    // =============================================
+    // Frame Pacing
+    // =============================================
+
+    bool NeedsRedraw()
+    {
+        return Animation::GetRedrawDelay() <= 0.0f;
+    }
+
+    float NextAnimationDeadline()
+    {
+        return Animation::GetRedrawDelay();
+    }
+
     // =============================================
     // Layer System
     // =============================================
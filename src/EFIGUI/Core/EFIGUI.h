@@ -15,7 +15,10 @@
 // Core headers
 #include "../Theme.h"
 #include "Animation.h"
+#include "Timeline.h"
 #include "Layer.h"
+#include "FrameArena.h"
+#include "WidgetStore.h"
 #include "Draw.h"
 #include "../Components.h"
 
@@ -72,8 +75,30 @@ namespace EFIGUI
     // Call at the end of each frame (required for Layer system)
     // Flushes all deferred drawing commands in layer order
     // targetDrawList: Optional custom draw list (nullptr = use ForegroundDrawList)
+    // In LayerFlushMode::PerWindow, window-owned commands go to their window's DrawList instead
     void EndFrame(ImDrawList* targetDrawList = nullptr);
 
+    // Get the per-frame scratch allocator (reset by BeginFrame)
+    // Use for transient data that only needs to live until the end of the frame.
+    // GetFrameArena().GetHighWaterMark() reports the peak bytes used by one frame.
+    FrameArena& GetFrameArena();
+
+    // =============================================
+    // Frame Pacing
+    // =============================================
+    // Query after EndFrame to decide when the next frame is needed. Widget
+    // states still converging and continuous effects (marquee sweep, status
+    // pulse, cooldown overlay, panel glow) keep the UI animating; custom
+    // widgets can add their own requests with Animation::RequestRedraw().
+    // Input handling is the host's responsibility: wake up on input events.
+
+    // True if the last frame left something animating (redraw next frame)
+    bool NeedsRedraw();
+
+    // Seconds from the last frame until the next visible change
+    // 0 = redraw immediately, FLT_MAX = nothing scheduled (idle until input)
+    float NextAnimationDeadline();
+
     // =============================================
     // Layer System
     // =============================================
@@ -0,0 +1,99 @@
+#include "Animation.h"
+#include "Timeline.h"
+#include <cmath>
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        // =============================================
+        // Easing Functions
+        // =============================================
+
+        namespace
+        {
+            constexpr float TwoPi = 2.0f * 3.14159f;
+            constexpr float BackOvershoot = 1.70158f;
+            constexpr int ElasticTableSize = 512;
+
+            float EaseOutElasticExact(float t)
+            {
+                const float c4 = TwoPi / 3.0f;
+                return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
+            }
+
+            // EaseOutElastic sampled over [0, 1]; linear interpolation between
+            // samples stays within ~2e-4 of the exact curve
+            struct ElasticTable
+            {
+                float values[ElasticTableSize + 1];
+
+                ElasticTable()
+                {
+                    for (int i = 0; i <= ElasticTableSize; i++)
+                        values[i] = EaseOutElasticExact((float)i / ElasticTableSize);
+                }
+            };
+
+            const ElasticTable& GetElasticTable()
+            {
+                static const ElasticTable s_table;
+                return s_table;
+            }
+        }
+
+        float EaseOutQuad(float t)
+        {
+            return 1.0f - (1.0f - t) * (1.0f - t);
+        }
+
+        float EaseInQuad(float t)
+        {
+            return t * t;
+        }
+
+        float EaseInOutQuad(float t)
+        {
+            if (t < 0.5f)
+                return 2.0f * t * t;
+            float u = -2.0f * t + 2.0f;
+            return 1.0f - u * u * 0.5f;
+        }
+
+        float EaseOutBack(float t)
+        {
+            const float c1 = BackOvershoot;
+            const float c3 = c1 + 1.0f;
+            float u = t - 1.0f;
+            return 1.0f + u * u * (c3 * u + c1);
+        }
+
+        float EaseOutElastic(float t)
+        {
+            if (t == 0.0f) return 0.0f;
+            if (t == 1.0f) return 1.0f;
+            if (!(t > 0.0f && t < 1.0f))
+                return EaseOutElasticExact(t);
+
+            const float* values = GetElasticTable().values;
+            float x = t * ElasticTableSize;
+            int i = (int)x;
+            float frac = x - (float)i;
+            return values[i] + (values[i + 1] - values[i]) * frac;
+        }
+
+        float ApplyEase(Ease ease, float t)
+        {
+            switch (ease)
+            {
+            case Ease::Linear:     return t;
+            case Ease::InQuad:     return EaseInQuad(t);
+            case Ease::OutQuad:    return EaseOutQuad(t);
+            case Ease::InOutQuad:  return EaseInOutQuad(t);
+            case Ease::OutBack:    return EaseOutBack(t);
+            case Ease::OutElastic: return EaseOutElastic(t);
+            }
+            return t;
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace EFIGUI
+{
+    FrameArena::FrameArena(size_t initialBlockSize)
+        : m_initialBlockSize(initialBlockSize > 0 ? initialBlockSize : DefaultBlockSize)
+    {
+    }
+
+    void FrameArena::AddBlock(size_t minSize)
+    {
+        Block block;
+        block.size = std::max(minSize, m_initialBlockSize);
+        block.data = std::make_unique<char[]>(block.size);
+        m_blocks.push_back(std::move(block));
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        if (size == 0)
+            size = 1;
+
+        if (m_blocks.empty())
+            AddBlock(size + alignment);
+
+        for (;;)
+        {
+            Block& block = m_blocks[m_current];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+            uintptr_t cursor = base + block.used;
+            uintptr_t aligned = (cursor + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            size_t padding = static_cast<size_t>(aligned - cursor);
+
+            if (block.used + padding + size <= block.size)
+            {
+                block.used += padding + size;
+                m_usedBytes += padding + size;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            // Current block is full: move to the next one (chained until the next Reset)
+            if (m_current + 1 >= m_blocks.size())
+                AddBlock(size + alignment);
+            m_current++;
+        }
+    }
+
+    const char* FrameArena::CopyString(const char* text, const char* textEnd)
+    {
+        if (!text)
+            return "";
+
+        size_t len = textEnd ? static_cast<size_t>(textEnd - text) : strlen(text);
+        char* copy = static_cast<char*>(Allocate(len + 1, 1));
+        memcpy(copy, text, len);
+        copy[len] = '\0';
+        return copy;
+    }
+
+    const char* FrameArena::Format(const char* fmt, ...)
+    {
+        va_list args;
+        va_start(args, fmt);
+        const char* result = FormatV(fmt, args);
+        va_end(args);
+        return result;
+    }
+
+    const char* FrameArena::FormatV(const char* fmt, va_list args)
+    {
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        int len = vsnprintf(nullptr, 0, fmt, argsCopy);
+        va_end(argsCopy);
+
+        if (len < 0)
+            return "";
+
+        char* buf = static_cast<char*>(Allocate(static_cast<size_t>(len) + 1, 1));
+        vsnprintf(buf, static_cast<size_t>(len) + 1, fmt, args);
+        return buf;
+    }
+
+    void FrameArena::Reset()
+    {
+        m_highWaterMark = std::max(m_highWaterMark, m_usedBytes);
+
+        // Coalesce chained blocks so the next frame fits in one allocation
+        if (m_blocks.size() > 1)
+        {
+            size_t total = GetCapacity();
+            m_blocks.clear();
+            AddBlock(total);
+        }
+        else if (!m_blocks.empty())
+        {
+            m_blocks[0].used = 0;
+        }
+
+        m_current = 0;
+        m_usedBytes = 0;
+    }
+
+    size_t FrameArena::GetCapacity() const
+    {
+        size_t total = 0;
+        for (const auto& block : m_blocks)
+            total += block.size;
+        return total;
+    }
+}
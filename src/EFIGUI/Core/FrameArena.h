@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdarg>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace EFIGUI
+{
+    // =============================================
+    // Frame Arena
+    // =============================================
+    // Linear allocator for transient per-frame data (text copies, scratch
+    // point buffers, temporary labels). Memory is released all at once by
+    // Reset(), which EFIGUI::BeginFrame() calls every frame.
+    //
+    // When a frame overflows the current block, extra blocks are chained.
+    // On the next Reset() they are coalesced into a single block sized to
+    // the high-water mark, so a warm UI performs no heap allocations.
+    //
+    // Pointers returned by the arena are only valid until the next Reset().
+    // Only trivially destructible types may be placed in the arena.
+
+    class FrameArena
+    {
+    public:
+        static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+        explicit FrameArena(size_t initialBlockSize = DefaultBlockSize);
+        ~FrameArena() = default;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // Allocate raw memory (uninitialized)
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Allocate an uninitialized array of trivially destructible elements
+        template<typename T>
+        T* AllocateArray(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "FrameArena only holds trivially destructible types");
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        // Copy a string (or [text, textEnd) range) into the arena
+        const char* CopyString(const char* text, const char* textEnd = nullptr);
+
+        // printf-style formatting into the arena
+        const char* Format(const char* fmt, ...);
+        const char* FormatV(const char* fmt, va_list args);
+
+        // Release every allocation made since the last Reset()
+        void Reset();
+
+        // Statistics
+        size_t GetUsedBytes() const { return m_usedBytes; }         // Bytes handed out this frame
+        size_t GetCapacity() const;                                 // Bytes currently reserved
+        size_t GetHighWaterMark() const                             // Peak bytes used in a single frame
+        {
+            return m_usedBytes > m_highWaterMark ? m_usedBytes : m_highWaterMark;
+        }
+        size_t GetBlockCount() const { return m_blocks.size(); }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<char[]> data;
+            size_t size = 0;
+            size_t used = 0;
+        };
+
+        void AddBlock(size_t minSize);
+
+        std::vector<Block> m_blocks;
+        size_t m_current = 0;           // Index of the block being filled
+        size_t m_usedBytes = 0;
+        size_t m_highWaterMark = 0;
+        size_t m_initialBlockSize;
+    };
+}
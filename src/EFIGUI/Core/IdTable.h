@@ -0,0 +1,302 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace EFIGUI
+{
+    // =============================================
+    // ID Table
+    // =============================================
+    // Open-addressing map from ImGuiID (any 32-bit key) to a value slot.
+    //
+    // - The index is a flat array of {key, slot} pairs with linear probing and
+    //   backward-shift deletion (no tombstones), kept at most half full.
+    // - Values live in fixed-size pages that never move, so references stay
+    //   valid across insertions; only Remove/RemoveIf/Clear invalidate the
+    //   removed entries.
+    // - Freed slots are recycled, and RemoveIf walks the dense slot array
+    //   instead of hash buckets.
+    //
+    // Values must be default constructible; a reused slot is reset to T{}.
+
+    template<typename T, size_t PageSize = 256>
+    class IdTable
+    {
+    public:
+        using Key = uint32_t;
+
+        IdTable() = default;
+        IdTable(IdTable&&) noexcept = default;
+        IdTable& operator=(IdTable&&) noexcept = default;
+
+        // Deep copy (pages are owned); lets tables live in copyable holders
+        IdTable(const IdTable& other)
+            : m_index(other.m_index), m_slotKeys(other.m_slotKeys), m_slotLive(other.m_slotLive),
+              m_freeSlots(other.m_freeSlots), m_size(other.m_size)
+        {
+            m_pages.reserve(other.m_pages.size());
+            for (const auto& page : other.m_pages)
+            {
+                auto copy = std::make_unique<T[]>(PageSize);
+                std::copy(page.get(), page.get() + PageSize, copy.get());
+                m_pages.push_back(std::move(copy));
+            }
+        }
+
+        IdTable& operator=(const IdTable& other)
+        {
+            if (this != &other)
+                *this = IdTable(other);
+            return *this;
+        }
+
+        // Get or create the value for an id (new values are T{})
+        T& GetOrCreate(Key id)
+        {
+            if ((m_size + 1) * 2 > m_index.size())
+                Rehash(m_index.empty() ? 64 : m_index.size() * 2);
+
+            size_t mask = m_index.size() - 1;
+            for (size_t i = Hash(id) & mask;; i = (i + 1) & mask)
+            {
+                Entry& entry = m_index[i];
+                if (entry.slot == EmptySlot)
+                {
+                    entry.key = id;
+                    entry.slot = AllocateSlot(id);
+                    m_size++;
+                    return SlotValue(entry.slot);
+                }
+                if (entry.key == id)
+                    return SlotValue(entry.slot);
+            }
+        }
+
+        // Find an existing value (nullptr if absent)
+        T* Find(Key id)
+        {
+            size_t i = FindIndex(id);
+            return i == NotFound ? nullptr : &SlotValue(m_index[i].slot);
+        }
+
+        const T* Find(Key id) const
+        {
+            size_t i = FindIndex(id);
+            return i == NotFound ? nullptr : &SlotValue(m_index[i].slot);
+        }
+
+        bool Contains(Key id) const { return FindIndex(id) != NotFound; }
+
+        bool Remove(Key id)
+        {
+            size_t i = FindIndex(id);
+            if (i == NotFound)
+                return false;
+            ReleaseSlot(m_index[i].slot);
+            EraseIndex(i);
+            return true;
+        }
+
+        // Remove every entry for which pred(id, value) returns true.
+        // Walks the slot array, so cost is proportional to the slot count.
+        template<typename Pred>
+        size_t RemoveIf(Pred pred)
+        {
+            return RemoveIfInRange(0, m_slotKeys.size(), pred);
+        }
+
+        // RemoveIf restricted to slots [begin, end); lets callers spread
+        // pruning across frames with a cursor (see GetSlotCount)
+        template<typename Pred>
+        size_t RemoveIfInRange(size_t begin, size_t end, Pred pred)
+        {
+            size_t removed = 0;
+            end = end < m_slotKeys.size() ? end : m_slotKeys.size();
+            for (size_t slot = begin; slot < end; slot++)
+            {
+                if (!m_slotLive[slot])
+                    continue;
+                Key id = m_slotKeys[slot];
+                if (pred(id, SlotValue(static_cast<uint32_t>(slot))))
+                {
+                    Remove(id);
+                    removed++;
+                }
+            }
+            return removed;
+        }
+
+        // Incremental RemoveIf: each call examines about 1/sweepSteps of the
+        // slots (at least MinStepSlots), continuing from cursor and wrapping,
+        // so a full sweep completes every sweepSteps calls at a bounded cost
+        template<typename Pred>
+        size_t RemoveIfStep(size_t& cursor, size_t sweepSteps, Pred pred)
+        {
+            size_t slots = m_slotKeys.size();
+            if (slots == 0)
+            {
+                cursor = 0;
+                return 0;
+            }
+            if (cursor >= slots)
+                cursor = 0;
+
+            size_t budget = std::max(MinStepSlots, slots / std::max<size_t>(sweepSteps, 1));
+            size_t end = std::min(cursor + budget, slots);
+            size_t removed = RemoveIfInRange(cursor, end, pred);
+            cursor = end;
+            return removed;
+        }
+
+        // Visit every live entry: fn(id, value)
+        template<typename Fn>
+        void ForEach(Fn fn)
+        {
+            for (size_t slot = 0; slot < m_slotKeys.size(); slot++)
+            {
+                if (m_slotLive[slot])
+                    fn(m_slotKeys[slot], SlotValue(static_cast<uint32_t>(slot)));
+            }
+        }
+
+        // Drop all entries (pages are kept for reuse)
+        void Clear()
+        {
+            for (auto& entry : m_index)
+                entry.slot = EmptySlot;
+            m_freeSlots.clear();
+            for (size_t slot = m_slotKeys.size(); slot-- > 0;)
+            {
+                m_slotLive[slot] = 0;
+                m_freeSlots.push_back(static_cast<uint32_t>(slot));
+            }
+            m_size = 0;
+        }
+
+        size_t Size() const { return m_size; }
+        bool Empty() const { return m_size == 0; }
+
+        // Slots ever allocated (live + free); upper bound for RemoveIfInRange
+        size_t GetSlotCount() const { return m_slotKeys.size(); }
+
+        // Heap memory held by the table
+        size_t GetMemoryBytes() const
+        {
+            return m_index.capacity() * sizeof(Entry) +
+                   m_pages.size() * (sizeof(T) * PageSize + sizeof(std::unique_ptr<T[]>)) +
+                   m_slotKeys.capacity() * sizeof(Key) +
+                   m_slotLive.capacity() * sizeof(uint8_t) +
+                   m_freeSlots.capacity() * sizeof(uint32_t);
+        }
+
+    private:
+        static constexpr uint32_t EmptySlot = UINT32_MAX;
+        static constexpr size_t NotFound = SIZE_MAX;
+        static constexpr size_t MinStepSlots = 64;
+
+        struct Entry
+        {
+            Key key = 0;
+            uint32_t slot = EmptySlot;
+        };
+
+        // ImGuiIDs are already hashes, but sequential ids (PushID(i)) cluster;
+        // a multiplicative mix spreads them across the index
+        static size_t Hash(Key id)
+        {
+            uint32_t h = id * 0x9E3779B1u;
+            return static_cast<size_t>(h ^ (h >> 15));
+        }
+
+        size_t FindIndex(Key id) const
+        {
+            if (m_size == 0)
+                return NotFound;
+            size_t mask = m_index.size() - 1;
+            for (size_t i = Hash(id) & mask;; i = (i + 1) & mask)
+            {
+                const Entry& entry = m_index[i];
+                if (entry.slot == EmptySlot)
+                    return NotFound;
+                if (entry.key == id)
+                    return i;
+            }
+        }
+
+        // Backward-shift deletion keeps probe sequences intact without tombstones
+        void EraseIndex(size_t hole)
+        {
+            size_t mask = m_index.size() - 1;
+            for (size_t i = (hole + 1) & mask; m_index[i].slot != EmptySlot; i = (i + 1) & mask)
+            {
+                size_t home = Hash(m_index[i].key) & mask;
+                // Move the entry into the hole if its home is not in (hole, i]
+                if (((i - home) & mask) >= ((i - hole) & mask))
+                {
+                    m_index[hole] = m_index[i];
+                    hole = i;
+                }
+            }
+            m_index[hole].slot = EmptySlot;
+            m_size--;
+        }
+
+        void Rehash(size_t newCapacity)
+        {
+            std::vector<Entry> old;
+            old.swap(m_index);
+            m_index.resize(newCapacity);
+            size_t mask = newCapacity - 1;
+            for (const Entry& entry : old)
+            {
+                if (entry.slot == EmptySlot)
+                    continue;
+                size_t i = Hash(entry.key) & mask;
+                while (m_index[i].slot != EmptySlot)
+                    i = (i + 1) & mask;
+                m_index[i] = entry;
+            }
+        }
+
+        uint32_t AllocateSlot(Key id)
+        {
+            uint32_t slot;
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+                SlotValue(slot) = T{};
+            }
+            else
+            {
+                slot = static_cast<uint32_t>(m_slotKeys.size());
+                if (slot % PageSize == 0)
+                    m_pages.push_back(std::make_unique<T[]>(PageSize));
+                m_slotKeys.push_back(0);
+                m_slotLive.push_back(0);
+            }
+            m_slotKeys[slot] = id;
+            m_slotLive[slot] = 1;
+            return slot;
+        }
+
+        void ReleaseSlot(uint32_t slot)
+        {
+            m_slotLive[slot] = 0;
+            m_freeSlots.push_back(slot);
+        }
+
+        T& SlotValue(uint32_t slot) { return m_pages[slot / PageSize][slot % PageSize]; }
+        const T& SlotValue(uint32_t slot) const { return m_pages[slot / PageSize][slot % PageSize]; }
+
+        std::vector<Entry> m_index;                     // Power-of-two sized, <= 50% full
+        std::vector<std::unique_ptr<T[]>> m_pages;      // Stable value storage
+        std::vector<Key> m_slotKeys;                    // Key owning each slot
+        std::vector<uint8_t> m_slotLive;                // 1 = slot in use
+        std::vector<uint32_t> m_freeSlots;
+        size_t m_size = 0;
+    };
+}
@@ -1,6 +1,13 @@
 #include "Layer.h"
+#include "EFIGUI.h"
+#include "Draw.h"
+#include "imgui_internal.h"
 #include <algorithm>
-#include <string>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 
 namespace EFIGUI
 {
@@ -26,6 +33,152 @@ namespace EFIGUI
         return instance;
     }
 
+    thread_local LayerManager::Recording* LayerManager::t_recording = nullptr;
+
+    // Window that owns submissions from the calling thread. ImGui's implicit
+    // "Debug##Default" window does not count: commands made outside Begin/End
+    // are neither clipped to it nor merged into it.
+    static ImGuiWindow* GetSubmittingWindow()
+    {
+        ImGuiContext* ctx = ImGui::GetCurrentContext();
+        if (!ctx || !ctx->CurrentWindow || ctx->CurrentWindow->IsFallbackWindow)
+            return nullptr;
+        return ctx->CurrentWindow;
+    }
+
+    LayerManager::LayerManager() = default;
+
+    LayerManager::~LayerManager() = default;
+
+    void LayerManager::CommandBuffer::Clear()
+    {
+        for (auto& commands : this->commands)
+            commands.clear();
+    }
+
+    bool LayerManager::CommandBuffer::Empty() const
+    {
+        for (const auto& commands : this->commands)
+        {
+            if (!commands.empty())
+                return false;
+        }
+        return true;
+    }
+
+    void LayerManager::CommandBuffer::Push(size_t layerIdx, const DeferredDrawCommand& cmd)
+    {
+        // Track the priority range so Flush can skip or bucket the sort
+        auto& layerCommands = commands[layerIdx];
+        if (layerCommands.empty())
+        {
+            minPriority[layerIdx] = maxPriority[layerIdx] = cmd.priority;
+        }
+        else
+        {
+            minPriority[layerIdx] = std::min(minPriority[layerIdx], cmd.priority);
+            maxPriority[layerIdx] = std::max(maxPriority[layerIdx], cmd.priority);
+        }
+        layerCommands.push_back(cmd);
+    }
+
+    void LayerManager::Recording::Reset()
+    {
+        // Clear all command buffers (capacity is kept for reuse)
+        for (size_t i = 0; i < activeBuffers; i++)
+        {
+            buffers[i].Clear();
+            buffers[i].owner = nullptr;
+        }
+        activeBuffers = 1;
+        lastBuffer = 0;
+        callbacks.clear();
+        textArena.Reset();
+        for (auto& count : culled)
+            count = 0;
+        popupContextDepth = 0;
+    }
+
+    LayerManager::CommandBuffer& LayerManager::Recording::GetBuffer(ImDrawList* owner)
+    {
+        if (buffers[lastBuffer].owner == owner)
+            return buffers[lastBuffer];
+
+        // Few windows are open at once, a linear scan beats hashing here
+        for (size_t i = 0; i < activeBuffers; i++)
+        {
+            if (buffers[i].owner == owner)
+            {
+                lastBuffer = i;
+                return buffers[i];
+            }
+        }
+
+        if (activeBuffers == buffers.size())
+            buffers.emplace_back();
+        lastBuffer = activeBuffers++;
+        buffers[lastBuffer].owner = owner;
+        return buffers[lastBuffer];
+    }
+
+    LayerManager::Recording& LayerManager::GetRecording()
+    {
+        return t_recording ? *t_recording : *m_main;
+    }
+
+    const LayerManager::Recording& LayerManager::GetRecording() const
+    {
+        return t_recording ? *t_recording : *m_main;
+    }
+
+    LayerManager::CommandBuffer& LayerManager::GetSubmitBuffer(Recording& recording)
+    {
+        ImGuiWindow* window = GetSubmittingWindow();
+        if (m_config.flushMode != LayerFlushMode::PerWindow || !window)
+            return recording.buffers[0];
+        return recording.GetBuffer(window->DrawList);
+    }
+
+    void LayerManager::MergeRecordings()
+    {
+        std::lock_guard<std::mutex> lock(m_recordingMutex);
+
+        // Deterministic order: by sequence, independent of when each thread finished
+        std::stable_sort(m_recordings.begin(), m_recordings.end(),
+            [](const std::unique_ptr<Recording>& a, const std::unique_ptr<Recording>& b) {
+                return a->sequence < b->sequence;
+            });
+
+        for (const auto& recording : m_recordings)
+        {
+            const uint32_t callbackBase = static_cast<uint32_t>(m_main->callbacks.size());
+            for (auto& callback : recording->callbacks)
+                m_main->callbacks.push_back(std::move(callback));
+
+            for (size_t i = 0; i < recording->activeBuffers; i++)
+            {
+                CommandBuffer& source = recording->buffers[i];
+                CommandBuffer& target = m_main->GetBuffer(source.owner);
+                for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+                {
+                    for (DeferredDrawCommand cmd : source.commands[layerIdx])
+                    {
+                        if (cmd.type == DrawCommandType::Callback)
+                            cmd.data.callback.index += callbackBase;
+
+                        // The worker recording is reset and pooled at the next BeginFrame,
+                        // which a sealed frame (double-buffered mode) outlives
+                        CopyCommandPayload(cmd, m_main->textArena);
+                        target.Push(layerIdx, cmd);
+                    }
+                }
+            }
+
+            for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+                m_main->culled[layerIdx] += recording->culled[layerIdx];
+        }
+    }
+
     void LayerManager::SetConfig(const LayerConfig& config)
     {
         m_config = config;
@@ -36,112 +189,868 @@ namespace EFIGUI
         return m_config;
     }
 
-    void LayerManager::AddDrawCommand(Layer layer, std::function<void(ImDrawList*)> command, int priority)
+    // Anti-aliasing fringe added around primitive bounds before culling
+    static constexpr float CullMargin = 1.0f;
+
+    static ImVec4 RectBounds(ImVec2 min, ImVec2 max, float expand)
+    {
+        expand += CullMargin;
+        return ImVec4(min.x - expand, min.y - expand, max.x + expand, max.y + expand);
+    }
+
+    // Text width is not measured at submission; only the left/top/bottom edges are known
+    static ImVec4 TextBounds(ImVec2 pos, float fontSize, const char* text)
+    {
+        float bottom = strchr(text, '\n') ? FLT_MAX : pos.y + fontSize + CullMargin;
+        return ImVec4(pos.x - CullMargin, pos.y - CullMargin, FLT_MAX, bottom);
+    }
+
+    static ImVec4 PointsBounds(const ImVec2* points, int count, float expand)
+    {
+        ImVec2 min(FLT_MAX, FLT_MAX), max(-FLT_MAX, -FLT_MAX);
+        for (int i = 0; i < count; i++)
+        {
+            min = ImVec2(std::min(min.x, points[i].x), std::min(min.y, points[i].y));
+            max = ImVec2(std::max(max.x, points[i].x), std::max(max.y, points[i].y));
+        }
+        return RectBounds(min, max, expand);
+    }
+
+    // Longest miter of a polyline joint as a multiple of the half-width:
+    // AddPolylineMultiColorToDrawList caps it at 2, ImDrawList::AddPolyline at
+    // 10 (IM_FIXNORMAL2F_MAX_INVLEN2 = 100)
+    static constexpr float MultiColorMaxMiter = 2.0f;
+    static constexpr float ImGuiMaxMiter = 10.0f;
+
+    // Farthest a polyline's triangles reach from its points: the outer edge
+    // of the 1px anti-aliasing fringe lies (thickness + 1) / 2 from the line
+    // (1 for thin lines), pushed out by the longest miter
+    static float PolylineExtent(float thickness, float maxMiter)
     {
-        Layer effectiveLayer = GetEffectiveLayer(layer);
+        return (std::max(thickness, 1.0f) + 1.0f) * 0.5f * maxMiter;
+    }
+
+    // Polyline with per-vertex colors: a core strip of the line's width plus a
+    // one pixel transparent fringe on each side, joints mitered from the
+    // averaged segment normals (ImDrawList::AddPolyline only takes one color)
+    static void AddPolylineMultiColorToDrawList(ImDrawList* draw, const DrawCmdPolyline& p)
+    {
+        const int count = p.count;
+        const int segments = p.closed ? count : count - 1;
+        if (segments < 1)
+            return;
+
+        const float halfWidth = std::max(p.thickness - 1.0f, 0.0f) * 0.5f;
+        const float fringe = 1.0f;
+        const ImVec2 uv = draw->_Data->TexUvWhitePixel;
+
+        draw->PrimReserve(segments * 18, count * 4);
+        const unsigned int base = draw->_VtxCurrentIdx;
+
+        for (int i = 0; i < count; i++)
+        {
+            // Normals of the segments entering and leaving this point
+            int prev = (i > 0) ? i - 1 : (p.closed ? count - 1 : i);
+            int next = (i < count - 1) ? i + 1 : (p.closed ? 0 : i);
+            ImVec2 nIn(0.0f, 0.0f), nOut(0.0f, 0.0f);
+            if (prev != i)
+            {
+                float dx = p.points[i].x - p.points[prev].x, dy = p.points[i].y - p.points[prev].y;
+                float len = std::sqrt(dx * dx + dy * dy);
+                if (len > 0.0f) nIn = ImVec2(dy / len, -dx / len);
+            }
+            if (next != i)
+            {
+                float dx = p.points[next].x - p.points[i].x, dy = p.points[next].y - p.points[i].y;
+                float len = std::sqrt(dx * dx + dy * dy);
+                if (len > 0.0f) nOut = ImVec2(dy / len, -dx / len);
+            }
+            if (prev == i) nIn = nOut;
+            if (next == i) nOut = nIn;
+
+            // Miter: average normal scaled by 1 / cos(half angle), capped for sharp turns
+            ImVec2 n((nIn.x + nOut.x) * 0.5f, (nIn.y + nOut.y) * 0.5f);
+            float d2 = n.x * n.x + n.y * n.y;
+            if (d2 > 0.000001f)
+            {
+                float scale = 1.0f / std::max(d2, 0.25f);
+                n = ImVec2(n.x * scale, n.y * scale);
+            }
+
+            const ImVec2 pt = p.points[i];
+            const ImU32 col = p.colors[i];
+            const ImU32 transparent = col & ~IM_COL32_A_MASK;
+            const float inner = halfWidth, outer = halfWidth + fringe;
+            draw->PrimWriteVtx(ImVec2(pt.x + n.x * outer, pt.y + n.y * outer), uv, transparent);
+            draw->PrimWriteVtx(ImVec2(pt.x + n.x * inner, pt.y + n.y * inner), uv, col);
+            draw->PrimWriteVtx(ImVec2(pt.x - n.x * inner, pt.y - n.y * inner), uv, col);
+            draw->PrimWriteVtx(ImVec2(pt.x - n.x * outer, pt.y - n.y * outer), uv, transparent);
+        }
+
+        // Three quads per segment: outer fringe, core, inner fringe
+        for (int s = 0; s < segments; s++)
+        {
+            const unsigned int a = base + s * 4;
+            const unsigned int b = base + ((s + 1) % count) * 4;
+            for (unsigned int k = 0; k < 3; k++)
+            {
+                draw->PrimWriteIdx((ImDrawIdx)(a + k));
+                draw->PrimWriteIdx((ImDrawIdx)(b + k));
+                draw->PrimWriteIdx((ImDrawIdx)(b + k + 1));
+                draw->PrimWriteIdx((ImDrawIdx)(a + k));
+                draw->PrimWriteIdx((ImDrawIdx)(b + k + 1));
+                draw->PrimWriteIdx((ImDrawIdx)(a + k + 1));
+            }
+        }
+    }
+
+    DeferredDrawCommand* LayerManager::Submit(Recording& recording, Layer layer, DeferredDrawCommand& cmd, const ImVec4* bounds, int priority)
+    {
+        Layer effectiveLayer = GetEffectiveLayer(layer);  // Uses the recording's popup depth
         size_t idx = static_cast<size_t>(effectiveLayer);
         if (idx < static_cast<size_t>(Layer::COUNT))
         {
-            m_commands[idx].push_back({ std::move(command), effectiveLayer, priority });
+            cmd.layer = effectiveLayer;
+            cmd.priority = priority;
+            cmd.clipped = false;
+
+            // Capture the submitting window's clip rect and drop commands fully outside it
+            ImGuiWindow* window = GetSubmittingWindow();
+            if (m_config.clipToWindow && window)
+            {
+                ImDrawList* windowDraw = window->DrawList;
+                ImVec2 clipMin = windowDraw->GetClipRectMin();
+                ImVec2 clipMax = windowDraw->GetClipRectMax();
+                cmd.clipRect = ImVec4(clipMin.x, clipMin.y, clipMax.x, clipMax.y);
+                cmd.clipped = true;
+
+                if (bounds && (bounds->x >= clipMax.x || bounds->z <= clipMin.x ||
+                               bounds->y >= clipMax.y || bounds->w <= clipMin.y))
+                {
+                    recording.culled[idx]++;
+                    return nullptr;
+                }
+            }
+
+            CommandBuffer& buffer = GetSubmitBuffer(recording);
+            auto& commands = buffer.commands[idx];
+            buffer.Push(idx, cmd);
+            return &commands.back();
         }
+        return nullptr;
+    }
+
+    void LayerManager::AddDrawCommand(Layer layer, std::function<void(ImDrawList*)> command, int priority)
+    {
+        Recording& recording = GetRecording();
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Callback;
+        cmd.color = 0;
+        cmd.data.callback.index = static_cast<uint32_t>(recording.callbacks.size());
+        recording.callbacks.push_back(std::move(command));
+        Submit(recording, layer, cmd, nullptr, priority);
     }
 
     void LayerManager::AddRectFilled(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding, ImDrawFlags flags)
     {
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddRectFilled(min, max, color, rounding, flags);
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::RectFilled;
+        cmd.color = color;
+        cmd.data.rect = { min, max, rounding, 0.0f, flags };
+        ImVec4 bounds = RectBounds(min, max, 0.0f);
+        Submit(GetRecording(), layer, cmd, &bounds);
     }
 
     void LayerManager::AddRect(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding, ImDrawFlags flags, float thickness)
     {
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddRect(min, max, color, rounding, flags, thickness);
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Rect;
+        cmd.color = color;
+        cmd.data.rect = { min, max, rounding, thickness, flags };
+        ImVec4 bounds = RectBounds(min, max, thickness * 0.5f);
+        Submit(GetRecording(), layer, cmd, &bounds);
     }
 
     void LayerManager::AddCircleFilled(Layer layer, ImVec2 center, float radius, ImU32 color, int num_segments)
     {
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddCircleFilled(center, radius, color, num_segments);
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::CircleFilled;
+        cmd.color = color;
+        cmd.data.circle = { center, radius, num_segments };
+        ImVec4 bounds = RectBounds(ImVec2(center.x - radius, center.y - radius),
+                                   ImVec2(center.x + radius, center.y + radius), 0.0f);
+        Submit(GetRecording(), layer, cmd, &bounds);
     }
 
     void LayerManager::AddLine(Layer layer, ImVec2 p1, ImVec2 p2, ImU32 color, float thickness)
     {
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddLine(p1, p2, color, thickness);
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Line;
+        cmd.color = color;
+        cmd.data.line = { p1, p2, thickness };
+        ImVec4 bounds = RectBounds(ImVec2(std::min(p1.x, p2.x), std::min(p1.y, p2.y)),
+                                   ImVec2(std::max(p1.x, p2.x), std::max(p1.y, p2.y)), thickness * 0.5f);
+        Submit(GetRecording(), layer, cmd, &bounds);
+    }
+
+    void LayerManager::AddPolyline(Layer layer, const ImVec2* points, int count, ImU32 color, float thickness, bool closed)
+    {
+        if (count < 2)
+            return;
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Polyline;
+        cmd.color = color;
+        cmd.data.polyline = { nullptr, nullptr, count, thickness, closed };
+        ImVec4 bounds = PointsBounds(points, count, PolylineExtent(thickness, ImGuiMaxMiter));
+
+        // Only copy the points once the command survived culling
+        Recording& recording = GetRecording();
+        if (DeferredDrawCommand* stored = Submit(recording, layer, cmd, &bounds))
+        {
+            ImVec2* copy = recording.textArena.AllocateArray<ImVec2>(count);
+            std::memcpy(copy, points, sizeof(ImVec2) * count);
+            stored->data.polyline.points = copy;
+        }
+    }
+
+    void LayerManager::AddPolylineMultiColor(Layer layer, const ImVec2* points, const ImU32* colors, int count, float thickness, bool closed)
+    {
+        if (count < 2)
+            return;
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Polyline;
+        cmd.color = colors[0];
+        cmd.data.polyline = { nullptr, nullptr, count, thickness, closed };
+        ImVec4 bounds = PointsBounds(points, count, PolylineExtent(thickness, MultiColorMaxMiter));
+
+        Recording& recording = GetRecording();
+        if (DeferredDrawCommand* stored = Submit(recording, layer, cmd, &bounds))
+        {
+            ImVec2* pointCopy = recording.textArena.AllocateArray<ImVec2>(count);
+            ImU32* colorCopy = recording.textArena.AllocateArray<ImU32>(count);
+            std::memcpy(pointCopy, points, sizeof(ImVec2) * count);
+            std::memcpy(colorCopy, colors, sizeof(ImU32) * count);
+            stored->data.polyline.points = pointCopy;
+            stored->data.polyline.colors = colorCopy;
+        }
+    }
+
+    void LayerManager::AddFeatheredRect(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding, float feather, bool filled, int cornerSegments)
+    {
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::FeatheredRect;
+        cmd.color = color;
+        cmd.data.feather = { min, max, rounding, feather, cornerSegments, filled };
+        ImVec4 bounds = RectBounds(min, max, feather);
+        Submit(GetRecording(), layer, cmd, &bounds);
+    }
+
+    void LayerManager::AddFeatheredCircle(Layer layer, ImVec2 center, float radius, ImU32 color, float feather, bool filled, int segments)
+    {
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::FeatheredCircle;
+        cmd.color = color;
+        cmd.data.feather = { center, center, radius, feather, segments, filled };
+        ImVec4 bounds = RectBounds(ImVec2(center.x - radius, center.y - radius),
+                                   ImVec2(center.x + radius, center.y + radius), feather);
+        Submit(GetRecording(), layer, cmd, &bounds);
     }
 
     void LayerManager::AddText(Layer layer, ImVec2 pos, ImU32 color, const char* text)
     {
-        // Copy the string to avoid dangling pointer
-        std::string textCopy = text;
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddText(pos, color, textCopy.c_str());
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::Text;
+        cmd.color = color;
+        if (!text) text = "";
+        ImVec4 bounds = TextBounds(pos, ImGui::GetFontSize(), text);
+        cmd.data.text = { pos, nullptr, 0.0f, nullptr };
+
+        // Only copy the string once the command survived culling
+        Recording& recording = GetRecording();
+        if (DeferredDrawCommand* stored = Submit(recording, layer, cmd, &bounds))
+            stored->data.text.text = recording.textArena.CopyString(text);
     }
 
     void LayerManager::AddText(Layer layer, ImFont* font, float font_size, ImVec2 pos, ImU32 color, const char* text)
     {
-        // Copy the string to avoid dangling pointer
-        std::string textCopy = text;
-        AddDrawCommand(layer, [=](ImDrawList* draw) {
-            draw->AddText(font, font_size, pos, color, textCopy.c_str());
-        });
+        DeferredDrawCommand cmd;
+        cmd.type = DrawCommandType::TextFont;
+        cmd.color = color;
+        if (!text) text = "";
+        ImVec4 bounds = TextBounds(pos, font_size, text);
+        cmd.data.text = { pos, font, font_size, nullptr };
+        Recording& recording = GetRecording();
+        if (DeferredDrawCommand* stored = Submit(recording, layer, cmd, &bounds))
+            stored->data.text.text = recording.textArena.CopyString(text);
     }
 
     void LayerManager::BeginFrame()
     {
-        // Clear all command buffers from previous frame
-        for (size_t i = 0; i < static_cast<size_t>(Layer::COUNT); i++)
+        // Clear all recordings from previous frame (capacity is kept for reuse)
+        m_main->Reset();
         {
-            m_commands[i].clear();
+            std::lock_guard<std::mutex> lock(m_recordingMutex);
+            for (auto& recording : m_recordings)
+            {
+                recording->Reset();
+                m_recordingPool.push_back(std::move(recording));
+            }
+            m_recordings.clear();
+        }
+        for (auto& stats : m_frameStats)
+            stats = LayerStats();
+        m_windowFlushTimeMs = 0.0f;
+    }
+
+    void LayerManager::Execute(ImDrawList* draw, const DeferredDrawCommand& cmd, const std::vector<DrawCallback>& callbacks) const
+    {
+        switch (cmd.type)
+        {
+            case DrawCommandType::RectFilled:
+            {
+                const DrawCmdRect& r = cmd.data.rect;
+                draw->AddRectFilled(r.min, r.max, cmd.color, r.rounding, r.flags);
+                break;
+            }
+            case DrawCommandType::Rect:
+            {
+                const DrawCmdRect& r = cmd.data.rect;
+                draw->AddRect(r.min, r.max, cmd.color, r.rounding, r.flags, r.thickness);
+                break;
+            }
+            case DrawCommandType::Line:
+            {
+                const DrawCmdLine& l = cmd.data.line;
+                draw->AddLine(l.p1, l.p2, cmd.color, l.thickness);
+                break;
+            }
+            case DrawCommandType::Polyline:
+            {
+                const DrawCmdPolyline& p = cmd.data.polyline;
+                if (p.colors)
+                    AddPolylineMultiColorToDrawList(draw, p);
+                else
+                    draw->AddPolyline(p.points, p.count, cmd.color, p.closed ? ImDrawFlags_Closed : ImDrawFlags_None, p.thickness);
+                break;
+            }
+            case DrawCommandType::CircleFilled:
+            {
+                const DrawCmdCircle& c = cmd.data.circle;
+                draw->AddCircleFilled(c.center, c.radius, cmd.color, c.numSegments);
+                break;
+            }
+            case DrawCommandType::FeatheredRect:
+            {
+                const DrawCmdFeather& f = cmd.data.feather;
+                Draw::FeatheredRect(draw, f.min, f.max, cmd.color, f.rounding, f.feather, f.filled, f.segments);
+                break;
+            }
+            case DrawCommandType::FeatheredCircle:
+            {
+                const DrawCmdFeather& f = cmd.data.feather;
+                Draw::FeatheredCircle(draw, f.min, f.rounding, cmd.color, f.feather, f.filled, f.segments);
+                break;
+            }
+            case DrawCommandType::Text:
+            {
+                const DrawCmdText& t = cmd.data.text;
+                draw->AddText(t.pos, cmd.color, t.text);
+                break;
+            }
+            case DrawCommandType::TextFont:
+            {
+                const DrawCmdText& t = cmd.data.text;
+                draw->AddText(t.font, t.fontSize, t.pos, cmd.color, t.text);
+                break;
+            }
+            case DrawCommandType::Callback:
+            {
+                callbacks[cmd.data.callback.index](draw);
+                break;
+            }
+            case DrawCommandType::COUNT:
+                break;
+        }
+    }
+
+    LayerSortMethod LayerManager::SortByPriority(CommandBuffer& buffer, size_t layerIdx)
+    {
+        auto& commands = buffer.commands[layerIdx];
+        const int minPriority = buffer.minPriority[layerIdx];
+        const int maxPriority = buffer.maxPriority[layerIdx];
+
+        // Common case: everything submitted at one priority (the convenience APIs use 0)
+        if (commands.size() < 2 || minPriority == maxPriority)
+            return LayerSortMethod::None;
+
+        const int64_t range = static_cast<int64_t>(maxPriority) - minPriority + 1;
+        if (range > MaxCountingSortRange)
+        {
+            std::stable_sort(commands.begin(), commands.end(),
+                [](const DeferredDrawCommand& a, const DeferredDrawCommand& b) {
+                    return a.priority < b.priority;
+                });
+            return LayerSortMethod::Comparison;
+        }
+
+        // Stable counting sort: histogram, prefix sum, scatter in submission order
+        m_sortCounts.assign(static_cast<size_t>(range) + 1, 0);
+        for (const auto& cmd : commands)
+            m_sortCounts[static_cast<size_t>(cmd.priority - minPriority) + 1]++;
+        for (size_t i = 1; i < m_sortCounts.size(); i++)
+            m_sortCounts[i] += m_sortCounts[i - 1];
+
+        m_sortScratch.resize(commands.size());
+        for (const auto& cmd : commands)
+            m_sortScratch[m_sortCounts[static_cast<size_t>(cmd.priority - minPriority)]++] = cmd;
+
+        commands.swap(m_sortScratch);
+        return LayerSortMethod::Counting;
+    }
+
+    void LayerManager::ReplayLayer(const Recording& recording, CommandBuffer& buffer, size_t layerIdx, ImDrawList* draw, LayerStats& stats)
+    {
+        auto& commands = buffer.commands[layerIdx];
+        if (commands.empty())
+            return;
+
+        const int vtxStart = draw->VtxBuffer.Size;
+        const int idxStart = draw->IdxBuffer.Size;
+
+        // Order by priority within the layer (lower priority first)
+        auto sortStart = std::chrono::steady_clock::now();
+        LayerSortMethod method = SortByPriority(buffer, layerIdx);
+        auto sortEnd = std::chrono::steady_clock::now();
+
+        stats.commandCount += static_cast<uint32_t>(commands.size());
+        if (method != LayerSortMethod::None)
+            stats.sortedCommands += static_cast<uint32_t>(commands.size());
+        stats.sortMethod = std::max(stats.sortMethod, method);
+        stats.sortTimeMs += std::chrono::duration<float, std::milli>(sortEnd - sortStart).count();
+
+        // Execute all commands, switching clip rects only when consecutive
+        // commands came from different windows
+        bool clipPushed = false;
+        ImVec4 currentClip;
+        for (const auto& cmd : commands)
+        {
+            if (cmd.clipped)
+            {
+                const ImVec4& c = cmd.clipRect;
+                if (!clipPushed || c.x != currentClip.x || c.y != currentClip.y ||
+                    c.z != currentClip.z || c.w != currentClip.w)
+                {
+                    if (clipPushed)
+                        draw->PopClipRect();
+                    draw->PushClipRect(ImVec2(c.x, c.y), ImVec2(c.z, c.w), true);
+                    clipPushed = true;
+                    currentClip = c;
+                }
+            }
+            else if (clipPushed)
+            {
+                draw->PopClipRect();
+                clipPushed = false;
+            }
+
+            Execute(draw, cmd, recording.callbacks);
+            stats.primitiveCounts[static_cast<size_t>(cmd.type)]++;
+        }
+        if (clipPushed)
+            draw->PopClipRect();
+
+        commands.clear();
+
+        stats.vertexCount += static_cast<uint32_t>(draw->VtxBuffer.Size - vtxStart);
+        stats.indexCount += static_cast<uint32_t>(draw->IdxBuffer.Size - idxStart);
+        stats.flushTimeMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - sortStart).count();
+    }
+
+    void LayerManager::MergeIntoOwner(const Recording& recording, CommandBuffer& buffer)
+    {
+        if (buffer.Empty())
+            return;
+
+        // One channel per layer keeps each window's vertices contiguous and
+        // in layer order on top of the content drawn so far
+        ImDrawList* draw = buffer.owner;
+        m_splitter.Split(draw, static_cast<int>(Layer::COUNT));
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+        {
+            if (buffer.commands[layerIdx].empty())
+                continue;
+            m_splitter.SetCurrentChannel(draw, static_cast<int>(layerIdx));
+            ReplayLayer(recording, buffer, layerIdx, draw, m_frameStats[layerIdx]);
+        }
+        m_splitter.Merge(draw);
+    }
+
+    void LayerManager::FlushWindow()
+    {
+        ImGuiWindow* window = GetSubmittingWindow();
+        if (m_config.flushMode != LayerFlushMode::PerWindow || m_config.doubleBuffered || !window)
+            return;
+
+        ImDrawList* owner = window->DrawList;
+        for (size_t i = 1; i < m_main->activeBuffers; i++)
+        {
+            if (m_main->buffers[i].owner == owner)
+            {
+                auto start = std::chrono::steady_clock::now();
+                MergeIntoOwner(*m_main, m_main->buffers[i]);
+                m_windowFlushTimeMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+                return;
+            }
         }
-        m_popupContextDepth = 0;
     }
 
     void LayerManager::Flush(ImDrawList* targetDrawList)
     {
+        auto flushStart = std::chrono::steady_clock::now();
+        MergeRecordings();
+
+        if (m_config.doubleBuffered)
+        {
+            SealFrame();
+            return;
+        }
+
+        // Windows that did not call FlushWindow() are merged into their own DrawList
+        for (size_t i = 0; i < m_main->activeBuffers; i++)
+        {
+            if (m_main->buffers[i].owner)
+                MergeIntoOwner(*m_main, m_main->buffers[i]);
+        }
+
         // Default to ForegroundDrawList if null, maintaining current behavior
         ImDrawList* draw = targetDrawList ? targetDrawList : ImGui::GetForegroundDrawList();
 
         // Execute commands layer by layer (Background first, Debug last)
         for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
         {
-            auto& commands = m_commands[layerIdx];
+            ReplayLayer(*m_main, m_main->GetBuffer(nullptr), layerIdx, draw, m_frameStats[layerIdx]);
+        }
 
-            // Sort by priority within each layer (lower priority first)
-            std::stable_sort(commands.begin(), commands.end(),
-                [](const DeferredDrawCommand& a, const DeferredDrawCommand& b) {
-                    return a.priority < b.priority;
-                });
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+        {
+            m_frameStats[layerIdx].culledCommands = m_main->culled[layerIdx];
+        }
+
+        float flushTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - flushStart).count();
+        PublishStats(m_frameStats, flushTimeMs + m_windowFlushTimeMs);
+    }
+
+    // =============================================
+    // Double-Buffered Mode
+    // =============================================
+
+    void LayerManager::FinishSealedFrame()
+    {
+        SealState state;
+        {
+            std::lock_guard<std::mutex> lock(m_fenceMutex);
+            state = m_sealState;
+        }
+
+        // Nobody picked the frame up: tessellate it here rather than drop it
+        if (state == SealState::Sealed)
+            TessellateSealedFrame();
+        WaitFence(m_sealedFence);
+    }
+
+    void LayerManager::SealFrame()
+    {
+        FinishSealedFrame();
+
+        // The recorded frame becomes immutable; BeginFrame resets the other one
+        std::swap(m_main, m_sealed);
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+            m_sealedStats[layerIdx].culledCommands = m_sealed->culled[layerIdx];
+
+        // Snapshot what tessellation reads from ImGui, NewFrame rewrites it
+        if (!m_sealedSharedData)
+            m_sealedSharedData = std::make_unique<ImDrawListSharedData>();
+        *m_sealedSharedData = *ImGui::GetDrawListSharedData();
+        m_sealedTexture = ImGui::GetIO().Fonts->TexID;
+        if (!m_sealedDrawList)
+            m_sealedDrawList = std::make_unique<ImDrawList>(m_sealedSharedData.get());
+
+        std::lock_guard<std::mutex> lock(m_fenceMutex);
+        m_sealedFence++;
+        m_sealState = SealState::Sealed;
+        m_sealedStatsPublished = false;
+    }
+
+    void LayerManager::TessellateSealedFrame()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_fenceMutex);
+            if (m_sealState != SealState::Sealed)
+                return;
+            m_sealState = SealState::Tessellating;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        ImDrawList* draw = m_sealedDrawList.get();
+        draw->_ResetForNewFrame();
+        draw->PushTextureID(m_sealedTexture);
+        draw->PushClipRectFullScreen();
+
+        // Window draw lists are reset by the next NewFrame, so every buffer
+        // (PerWindow included) is replayed here in global layer order
+        LayerStats stats[static_cast<size_t>(Layer::COUNT)];
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+        {
+            stats[layerIdx].culledCommands = m_sealedStats[layerIdx].culledCommands;
+            for (size_t i = 0; i < m_sealed->activeBuffers; i++)
+                ReplayLayer(*m_sealed, m_sealed->buffers[i], layerIdx, draw, stats[layerIdx]);
+        }
+
+        draw->PopClipRect();
+        draw->PopTextureID();
+        float flushTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        {
+            std::lock_guard<std::mutex> lock(m_fenceMutex);
+            for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+                m_sealedStats[layerIdx] = stats[layerIdx];
+            m_sealedFlushTimeMs = flushTimeMs;
+            m_sealState = SealState::Done;
+        }
+        m_fenceCondition.notify_all();
+    }
+
+    LayerFence LayerManager::GetSealedFence() const
+    {
+        std::lock_guard<std::mutex> lock(m_fenceMutex);
+        return m_sealedFence;
+    }
+
+    bool LayerManager::IsFenceComplete(LayerFence fence) const
+    {
+        std::lock_guard<std::mutex> lock(m_fenceMutex);
+        return fence < m_sealedFence || (fence == m_sealedFence && m_sealState != SealState::Sealed &&
+                                         m_sealState != SealState::Tessellating);
+    }
+
+    void LayerManager::WaitFence(LayerFence fence)
+    {
+        LayerStats stats[static_cast<size_t>(Layer::COUNT)];
+        float flushTimeMs;
+        {
+            std::unique_lock<std::mutex> lock(m_fenceMutex);
+            m_fenceCondition.wait(lock, [&] {
+                return fence < m_sealedFence || (m_sealState != SealState::Sealed && m_sealState != SealState::Tessellating);
+            });
+
+            if (m_sealState != SealState::Done || m_sealedStatsPublished)
+                return;
+            m_sealedStatsPublished = true;
+            for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+                stats[layerIdx] = m_sealedStats[layerIdx];
+            flushTimeMs = m_sealedFlushTimeMs;
+        }
+
+        // Publish the finished frame's stats on the waiting (main) thread
+        PublishStats(stats, flushTimeMs);
+    }
+
+    ImDrawList* LayerManager::GetSealedDrawList()
+    {
+        return m_sealedDrawList.get();
+    }
+
+    // =============================================
+    // Statistics
+    // =============================================
+
+    void LayerManager::PublishStats(const LayerStats* layers, float flushTimeMs)
+    {
+        m_statsHistoryHead = (m_statsHistoryHead + 1) % StatsHistoryFrames;
+        m_statsHistoryCount = std::min(m_statsHistoryCount + 1, StatsHistoryFrames);
 
-            // Execute all commands for this layer
-            for (const auto& cmd : commands)
+        LayerFrameStats& frame = m_statsHistory[m_statsHistoryHead];
+        frame = LayerFrameStats();
+        frame.flushTimeMs = flushTimeMs;
+
+        // Memory held by every recording (capacity, not just this frame's usage)
+        auto addRecordingBytes = [&](const Recording& recording) {
+            for (const auto& buffer : recording.buffers)
             {
-                cmd.command(draw);
+                for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+                    frame.layers[layerIdx].bufferBytes += buffer.commands[layerIdx].capacity() * sizeof(DeferredDrawCommand);
             }
+            frame.bufferBytes += recording.callbacks.capacity() * sizeof(DrawCallback) + recording.textArena.GetCapacity();
+        };
+        for (const auto& recording : m_frameRecordings)
+            addRecordingBytes(recording);
+        {
+            std::lock_guard<std::mutex> lock(m_recordingMutex);
+            for (const auto& recording : m_recordingPool)
+                addRecordingBytes(*recording);
+        }
+        frame.bufferBytes += m_sortScratch.capacity() * sizeof(DeferredDrawCommand) + m_sortCounts.capacity() * sizeof(uint32_t);
+
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+        {
+            LayerStats& stats = frame.layers[layerIdx];
+            size_t bufferBytes = stats.bufferBytes;
+            stats = layers[layerIdx];
+            stats.bufferBytes = bufferBytes;
+
+            frame.commandCount += stats.commandCount;
+            frame.vertexCount += stats.vertexCount;
+            frame.indexCount += stats.indexCount;
+            frame.bufferBytes += stats.bufferBytes;
         }
     }
 
+    const LayerStats& LayerManager::GetStats(Layer layer) const
+    {
+        size_t idx = static_cast<size_t>(layer);
+        IM_ASSERT(idx < static_cast<size_t>(Layer::COUNT));
+        return GetFrameStats().layers[idx];
+    }
+
+    const LayerFrameStats& LayerManager::GetFrameStats() const
+    {
+        return m_statsHistory[m_statsHistoryHead];
+    }
+
+    int LayerManager::GetStatsHistoryCount() const
+    {
+        return m_statsHistoryCount;
+    }
+
+    const LayerFrameStats& LayerManager::GetStatsHistory(int framesAgo) const
+    {
+        IM_ASSERT(framesAgo >= 0 && framesAgo < StatsHistoryFrames);
+        int idx = (m_statsHistoryHead - framesAgo + StatsHistoryFrames) % StatsHistoryFrames;
+        return m_statsHistory[idx];
+    }
+
+    // =============================================
+    // Stats Panel
+    // =============================================
+
+    namespace StatsPanelLocal
+    {
+        constexpr float Width = 420.0f;
+        constexpr float Padding = 6.0f;
+        constexpr float PlotHeight = 36.0f;
+        constexpr float PlotGap = 4.0f;
+        constexpr ImU32 BgColor = IM_COL32(8, 8, 16, 220);
+        constexpr ImU32 BorderColor = IM_COL32(80, 80, 110, 255);
+        constexpr ImU32 HeaderColor = IM_COL32(140, 140, 170, 255);
+        constexpr ImU32 TextColor = IM_COL32(220, 220, 230, 255);
+        constexpr ImU32 TimeColor = IM_COL32(0, 220, 255, 255);
+        constexpr ImU32 VertexColor = IM_COL32(200, 120, 255, 255);
+
+        // Column x offsets: Layer, Cmds, Culled, Vtx, Idx, KB, ms
+        constexpr float Columns[] = { 0.0f, 90.0f, 140.0f, 195.0f, 255.0f, 315.0f, 365.0f };
+    }
+
+    // History plot (oldest sample on the left), scaled to its own maximum
+    template<typename GetValue>
+    static void DrawStatsPlot(LayerManager& layers, ImVec2 min, ImVec2 max, int count, ImU32 color, const char* label, GetValue getValue)
+    {
+        using namespace StatsPanelLocal;
+
+        float peak = 0.0f;
+        for (int i = 0; i < count; i++)
+            peak = std::max(peak, getValue(i));
+
+        layers.AddRect(Layer::Debug, min, max, BorderColor);
+        char text[64];
+        snprintf(text, sizeof(text), "%s (peak %.2f)", label, peak);
+        layers.AddText(Layer::Debug, ImVec2(min.x + 2.0f, min.y + 1.0f), HeaderColor, text);
+
+        if (count < 2 || peak <= 0.0f)
+            return;
+
+        float step = (max.x - min.x) / (LayerManager::StatsHistoryFrames - 1);
+        auto point = [&](int framesAgo) {
+            float x = max.x - framesAgo * step;
+            float y = max.y - (max.y - min.y) * (getValue(framesAgo) / peak);
+            return ImVec2(x, y);
+        };
+        for (int i = 0; i + 1 < count; i++)
+            layers.AddLine(Layer::Debug, point(i + 1), point(i), color);
+    }
+
+    void LayerManager::DrawStatsPanel(ImVec2 pos)
+    {
+        using namespace StatsPanelLocal;
+
+        const LayerFrameStats& frame = GetFrameStats();
+        const float rowHeight = ImGui::GetFontSize() + 2.0f;
+        const int rows = static_cast<int>(Layer::COUNT) + 2;  // Header + layers + totals
+        const float height = Padding * 2 + rows * rowHeight + (PlotHeight + PlotGap) * 2;
+        const ImVec2 max(pos.x + Width, pos.y + height);
+
+        AddRectFilled(Layer::Debug, pos, max, BgColor, 4.0f);
+        AddRect(Layer::Debug, pos, max, BorderColor, 4.0f);
+
+        ImVec2 cursor(pos.x + Padding, pos.y + Padding);
+        auto row = [&](ImU32 color, const char* name, const char* cmds, const char* culled,
+                       const char* vtx, const char* idx, const char* kb, const char* ms) {
+            const char* cells[] = { name, cmds, culled, vtx, idx, kb, ms };
+            for (size_t i = 0; i < IM_ARRAYSIZE(cells); i++)
+                AddText(Layer::Debug, ImVec2(cursor.x + Columns[i], cursor.y), color, cells[i]);
+            cursor.y += rowHeight;
+        };
+
+        row(HeaderColor, "Layer", "Cmds", "Culled", "Vtx", "Idx", "KB", "ms");
+
+        char cmds[16], culled[16], vtx[16], idx[16], kb[16], ms[16];
+        for (size_t layerIdx = 0; layerIdx < static_cast<size_t>(Layer::COUNT); layerIdx++)
+        {
+            const LayerStats& stats = frame.layers[layerIdx];
+            snprintf(cmds, sizeof(cmds), "%u", stats.commandCount);
+            snprintf(culled, sizeof(culled), "%u", stats.culledCommands);
+            snprintf(vtx, sizeof(vtx), "%u", stats.vertexCount);
+            snprintf(idx, sizeof(idx), "%u", stats.indexCount);
+            snprintf(kb, sizeof(kb), "%.1f", stats.bufferBytes / 1024.0f);
+            snprintf(ms, sizeof(ms), "%.3f", stats.flushTimeMs);
+            row(TextColor, LayerToString(static_cast<Layer>(layerIdx)), cmds, culled, vtx, idx, kb, ms);
+        }
+
+        snprintf(cmds, sizeof(cmds), "%u", frame.commandCount);
+        snprintf(vtx, sizeof(vtx), "%u", frame.vertexCount);
+        snprintf(idx, sizeof(idx), "%u", frame.indexCount);
+        snprintf(kb, sizeof(kb), "%.1f", frame.bufferBytes / 1024.0f);
+        snprintf(ms, sizeof(ms), "%.3f", frame.flushTimeMs);
+        row(HeaderColor, "Frame", cmds, "", vtx, idx, kb, ms);
+
+        const int count = GetStatsHistoryCount();
+        ImVec2 plotMin(pos.x + Padding, cursor.y + PlotGap);
+        ImVec2 plotMax(max.x - Padding, plotMin.y + PlotHeight);
+        DrawStatsPlot(*this, plotMin, plotMax, count, TimeColor, "Flush ms",
+            [this](int framesAgo) { return GetStatsHistory(framesAgo).flushTimeMs; });
+
+        plotMin.y = plotMax.y + PlotGap;
+        plotMax.y = plotMin.y + PlotHeight;
+        DrawStatsPlot(*this, plotMin, plotMax, count, VertexColor, "Vertices",
+            [this](int framesAgo) { return static_cast<float>(GetStatsHistory(framesAgo).vertexCount); });
+    }
+
     void LayerManager::PushPopupContext()
     {
-        m_popupContextDepth++;
+        GetRecording().popupContextDepth++;
     }
 
     void LayerManager::PopPopupContext()
     {
-        if (m_popupContextDepth > 0)
+        Recording& recording = GetRecording();
+        if (recording.popupContextDepth > 0)
         {
-            m_popupContextDepth--;
+            recording.popupContextDepth--;
         }
     }
 
     bool LayerManager::IsInPopupContext() const
     {
-        return m_popupContextDepth > 0;
+        return GetRecording().popupContextDepth > 0;
     }
 
     Layer LayerManager::GetEffectiveLayer(Layer requestedLayer) const
@@ -162,4 +1071,37 @@ namespace EFIGUI
                 return requestedLayer;
         }
     }
+
+    // =============================================
+    // LayerRecordingScope
+    // =============================================
+
+    LayerRecordingScope::LayerRecordingScope(uint64_t sequence)
+        : m_previous(LayerManager::t_recording)
+    {
+        LayerManager& manager = LayerManager::Get();
+        {
+            std::lock_guard<std::mutex> lock(manager.m_recordingMutex);
+            if (!manager.m_recordingPool.empty())
+            {
+                m_recording = manager.m_recordingPool.back().release();
+                manager.m_recordingPool.pop_back();
+            }
+            else
+            {
+                m_recording = new LayerManager::Recording();
+            }
+        }
+        m_recording->sequence = sequence;
+        LayerManager::t_recording = m_recording;
+    }
+
+    LayerRecordingScope::~LayerRecordingScope()
+    {
+        LayerManager::t_recording = m_previous;
+
+        LayerManager& manager = LayerManager::Get();
+        std::lock_guard<std::mutex> lock(manager.m_recordingMutex);
+        manager.m_recordings.emplace_back(m_recording);
+    }
 }
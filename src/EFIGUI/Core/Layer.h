@@ -4,6 +4,11 @@
 #include <functional>
 #include <optional>
 #include <cstdint>
+#include <cstring>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include "FrameArena.h"
 
 namespace EFIGUI
 {
@@ -25,6 +30,13 @@ namespace EFIGUI
     // Convert Layer enum to string for debugging
     const char* LayerToString(Layer layer);
 
+    // Where deferred commands are replayed
+    enum class LayerFlushMode : uint8_t
+    {
+        SingleDrawList,     // Everything into EndFrame's target draw list (ForegroundDrawList by default)
+        PerWindow,          // Into the submitting window's own DrawList, one splitter channel per layer
+    };
+
     // Global layer configuration
     struct LayerConfig
     {
@@ -36,16 +48,177 @@ namespace EFIGUI
         Layer defaultTooltip         = Layer::Overlay;
 
         bool autoElevateInPopup = true;  // Auto-elevate glow layers inside popups
+        bool clipToWindow = true;        // Replay under the submitting window's clip rect, cull commands outside it
+        LayerFlushMode flushMode = LayerFlushMode::SingleDrawList;
+        bool doubleBuffered = false;     // Seal commands at EndFrame and tessellate them off the critical path
+    };
+
+    // Deferred draw command type (selects the active payload in DeferredDrawCommand)
+    enum class DrawCommandType : uint8_t
+    {
+        RectFilled,
+        Rect,
+        Line,
+        Polyline,           // Open or closed path, one color or one per vertex
+        CircleFilled,
+        FeatheredRect,      // Rounded-rect ring fading to zero alpha (glow)
+        FeatheredCircle,    // Circle ring fading to zero alpha (glow)
+        Text,               // Text with the current font
+        TextFont,           // Text with an explicit font and size
+        Callback,           // Type-erased std::function (slow path)
+
+        COUNT
+    };
+
+    // Fixed-size payloads for each primitive (plain data, no heap ownership)
+    struct DrawCmdRect
+    {
+        ImVec2 min;
+        ImVec2 max;
+        float rounding;
+        float thickness;
+        ImDrawFlags flags;
+    };
+
+    struct DrawCmdLine
+    {
+        ImVec2 p1;
+        ImVec2 p2;
+        float thickness;
+    };
+
+    struct DrawCmdPolyline
+    {
+        const ImVec2* points;   // Copy in the submitting recording's arena
+        const ImU32* colors;    // Per-vertex colors (nullptr = cmd.color), copy in the same arena
+        int count;
+        float thickness;
+        bool closed;
+    };
+
+    struct DrawCmdCircle
+    {
+        ImVec2 center;
+        float radius;
+        int numSegments;
     };
 
-    // Deferred draw command
+    struct DrawCmdFeather
+    {
+        ImVec2 min;             // FeatheredCircle: center
+        ImVec2 max;             // FeatheredCircle: unused
+        float rounding;         // FeatheredCircle: radius
+        float feather;          // Width of the fade beyond the shape
+        int segments;           // Per corner (rect) / around (circle)
+        bool filled;            // Also cover the interior with the full color
+    };
+
+    struct DrawCmdText
+    {
+        ImVec2 pos;
+        ImFont* font;           // Only used by DrawCommandType::TextFont
+        float fontSize;         // Only used by DrawCommandType::TextFont
+        const char* text;       // Copy in the submitting recording's arena
+    };
+
+    struct DrawCmdCallback
+    {
+        uint32_t index;         // Index into the manager's callback list
+    };
+
+    // Deferred draw command (tagged union, stored contiguously per layer)
     struct DeferredDrawCommand
     {
-        std::function<void(ImDrawList*)> command;
+        DrawCommandType type;
         Layer layer;
+        bool clipped;           // clipRect is valid (captured from the submitting window)
         int priority;
+        ImU32 color;
+        ImVec4 clipRect;        // Clip rect at submission (x1, y1, x2, y2)
+        union Payload
+        {
+            DrawCmdRect rect;
+            DrawCmdLine line;
+            DrawCmdPolyline polyline;
+            DrawCmdCircle circle;
+            DrawCmdFeather feather;
+            DrawCmdText text;
+            DrawCmdCallback callback;
+
+            Payload() {}
+        } data;
     };
 
+    // Copy a command's arena payload (text, polyline points and colors) into
+    // arena, so the command no longer references the recording it came from
+    inline void CopyCommandPayload(DeferredDrawCommand& cmd, FrameArena& arena)
+    {
+        switch (cmd.type)
+        {
+        case DrawCommandType::Text:
+        case DrawCommandType::TextFont:
+            if (cmd.data.text.text)
+                cmd.data.text.text = arena.CopyString(cmd.data.text.text);
+            break;
+        case DrawCommandType::Polyline:
+        {
+            DrawCmdPolyline& polyline = cmd.data.polyline;
+            if (polyline.points)
+            {
+                ImVec2* points = arena.AllocateArray<ImVec2>(polyline.count);
+                std::memcpy(points, polyline.points, sizeof(ImVec2) * polyline.count);
+                polyline.points = points;
+            }
+            if (polyline.colors)
+            {
+                ImU32* colors = arena.AllocateArray<ImU32>(polyline.count);
+                std::memcpy(colors, polyline.colors, sizeof(ImU32) * polyline.count);
+                polyline.colors = colors;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // How a layer's commands were ordered by priority during Flush
+    enum class LayerSortMethod : uint8_t
+    {
+        None,               // All commands share one priority, sort skipped
+        Counting,           // Stable counting sort over the priority range
+        Comparison,         // Stable comparison sort (priority range too wide for buckets)
+    };
+
+    // Per-layer statistics for the most recent Flush
+    struct LayerStats
+    {
+        uint32_t commandCount = 0;                          // Commands replayed
+        uint32_t culledCommands = 0;                        // Commands dropped at submission (outside their clip rect)
+        uint32_t primitiveCounts[static_cast<size_t>(DrawCommandType::COUNT)] = {};    // Commands per DrawCommandType
+        uint32_t vertexCount = 0;                           // Vertices written by the replay
+        uint32_t indexCount = 0;                            // Indices written by the replay
+        size_t bufferBytes = 0;                             // Command buffer memory held for this layer
+        uint32_t sortedCommands = 0;                        // Commands that went through a sort pass
+        LayerSortMethod sortMethod = LayerSortMethod::None;  // Most expensive method used
+        float sortTimeMs = 0.0f;                            // Time spent ordering by priority
+        float flushTimeMs = 0.0f;                           // Time spent sorting and replaying
+    };
+
+    // Whole-frame statistics, kept in a rolling history
+    struct LayerFrameStats
+    {
+        LayerStats layers[static_cast<size_t>(Layer::COUNT)];
+        uint32_t commandCount = 0;                          // Sum over layers
+        uint32_t vertexCount = 0;
+        uint32_t indexCount = 0;
+        size_t bufferBytes = 0;                             // Command buffers, callbacks, text arenas and sort scratch
+        float flushTimeMs = 0.0f;                           // Total time in Flush (or TessellateSealedFrame)
+    };
+
+    // Fence value identifying a sealed frame (double-buffered mode), 0 = none
+    using LayerFence = uint64_t;
+
     // Layer Manager (Singleton)
     class LayerManager
     {
@@ -56,11 +229,18 @@ namespace EFIGUI
         const LayerConfig& GetConfig() const;
 
         // Deferred drawing API
+        // AddDrawCommand is the type-erased slow path; prefer the typed primitives below.
         void AddDrawCommand(Layer layer, std::function<void(ImDrawList*)> command, int priority = 0);
         void AddRectFilled(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding = 0.0f, ImDrawFlags flags = 0);
         void AddRect(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding = 0.0f, ImDrawFlags flags = 0, float thickness = 1.0f);
         void AddCircleFilled(Layer layer, ImVec2 center, float radius, ImU32 color, int num_segments = 0);
         void AddLine(Layer layer, ImVec2 p1, ImVec2 p2, ImU32 color, float thickness = 1.0f);
+        void AddPolyline(Layer layer, const ImVec2* points, int count, ImU32 color, float thickness = 1.0f, bool closed = false);
+        // One color per point, interpolated along each segment (anti-aliased strip)
+        void AddPolylineMultiColor(Layer layer, const ImVec2* points, const ImU32* colors, int count, float thickness = 1.0f, bool closed = false);
+        // Glow meshes: full color at the shape's edge fading to zero alpha feather pixels out
+        void AddFeatheredRect(Layer layer, ImVec2 min, ImVec2 max, ImU32 color, float rounding, float feather, bool filled = true, int cornerSegments = 8);
+        void AddFeatheredCircle(Layer layer, ImVec2 center, float radius, ImU32 color, float feather, bool filled = true, int segments = 32);
         void AddText(Layer layer, ImVec2 pos, ImU32 color, const char* text);
         void AddText(Layer layer, ImFont* font, float font_size, ImVec2 pos, ImU32 color, const char* text);
 
@@ -68,6 +248,34 @@ namespace EFIGUI
         void BeginFrame();
         void Flush(ImDrawList* targetDrawList = nullptr);
 
+        // PerWindow mode: merge the current window's commands into its DrawList.
+        // Call before ImGui::End(); EFIGUI's window helpers do this automatically.
+        // Windows that never call it are merged into their DrawList by Flush.
+        void FlushWindow();
+
+        // Double-buffered mode (LayerConfig::doubleBuffered): EndFrame seals the frame's
+        // commands instead of replaying them. TessellateSealedFrame() (any thread, usually
+        // a worker) turns them into vertices while the next frame is recorded; once the
+        // fence completes, render GetSealedDrawList(). A frame that was never tessellated
+        // is tessellated by the next EndFrame before its buffers are reused.
+        LayerFence GetSealedFence() const;          // Most recently sealed frame
+        void TessellateSealedFrame();               // No-op if already tessellated
+        bool IsFenceComplete(LayerFence fence) const;
+        void WaitFence(LayerFence fence);
+        ImDrawList* GetSealedDrawList();            // Valid after the fence completes, until the next seal
+
+        // Statistics from the most recent Flush
+        const LayerStats& GetStats(Layer layer) const;
+        const LayerFrameStats& GetFrameStats() const;
+
+        // Rolling history of the last StatsHistoryFrames frames (framesAgo 0 = most recent)
+        static constexpr int StatsHistoryFrames = 120;
+        int GetStatsHistoryCount() const;
+        const LayerFrameStats& GetStatsHistory(int framesAgo) const;
+
+        // Debug panel on Layer::Debug: per-layer table plus flush time and vertex history plots
+        void DrawStatsPanel(ImVec2 pos);
+
         // Popup context tracking
         void PushPopupContext();
         void PopPopupContext();
@@ -75,10 +283,146 @@ namespace EFIGUI
         Layer GetEffectiveLayer(Layer requestedLayer) const;
 
     private:
-        LayerManager() = default;
+        LayerManager();
+        ~LayerManager();
+
+        using DrawCallback = std::function<void(ImDrawList*)>;
+
+        // Commands recorded for one destination, bucketed by layer
+        struct CommandBuffer
+        {
+            ImDrawList* owner = nullptr;    // Window draw list (PerWindow mode), nullptr = Flush target
+            std::vector<DeferredDrawCommand> commands[static_cast<size_t>(Layer::COUNT)];
+            int minPriority[static_cast<size_t>(Layer::COUNT)] = {};
+            int maxPriority[static_cast<size_t>(Layer::COUNT)] = {};
+
+            void Clear();
+            bool Empty() const;
+            void Push(size_t layerIdx, const DeferredDrawCommand& cmd);
+        };
+
+        // Everything one thread recorded: command buffers plus the state they reference
+        struct Recording
+        {
+            uint64_t sequence = 0;                          // Merge key (worker recordings only)
+            std::vector<CommandBuffer> buffers;             // [0] = Flush target, then one per window
+            size_t activeBuffers = 1;                       // Buffers in use this frame (the rest keep capacity)
+            size_t lastBuffer = 0;                          // Cache for consecutive submissions from one window
+            std::vector<DrawCallback> callbacks;
+            FrameArena textArena{ 4 * 1024 };               // Text and polyline payloads, lives as long as the commands
+            uint32_t culled[static_cast<size_t>(Layer::COUNT)] = {};
+            int popupContextDepth = 0;
+
+            Recording() : buffers(1) {}
+            void Reset();
+            CommandBuffer& GetBuffer(ImDrawList* owner);
+        };
+
+        // Recording that receives submissions from the calling thread
+        Recording& GetRecording();
+        const Recording& GetRecording() const;
+
+        // Buffer that receives commands submitted from the current window
+        CommandBuffer& GetSubmitBuffer(Recording& recording);
+
+        // Append worker recordings to the main recording in sequence order
+        void MergeRecordings();
+
+        // Queue a command on the effective layer. bounds (x1, y1, x2, y2) is used for
+        // culling against the captured clip rect; nullptr means unknown (never culled).
+        // Returns the stored record, or nullptr if the command was culled.
+        DeferredDrawCommand* Submit(Recording& recording, Layer layer, DeferredDrawCommand& cmd, const ImVec4* bounds, int priority = 0);
+
+        // Replay a single command onto the draw list
+        void Execute(ImDrawList* draw, const DeferredDrawCommand& cmd, const std::vector<DrawCallback>& callbacks) const;
+
+        // Order a layer's commands by priority (stable), returns the method used
+        LayerSortMethod SortByPriority(CommandBuffer& buffer, size_t layerIdx);
+
+        // Sort and replay one layer of a buffer onto a draw list, accumulating stats
+        void ReplayLayer(const Recording& recording, CommandBuffer& buffer, size_t layerIdx, ImDrawList* draw, LayerStats& stats);
+
+        // Replay a window-owned buffer into its DrawList through splitter channels
+        void MergeIntoOwner(const Recording& recording, CommandBuffer& buffer);
+
+        // Double-buffered mode: make the recorded frame immutable and start a new one
+        void SealFrame();
+
+        // Make sure the sealed frame is tessellated before its buffers are reused
+        void FinishSealedFrame();
+
+        // Record a finished frame's stats (main thread)
+        void PublishStats(const LayerStats* layers, float flushTimeMs);
+
+        enum class SealState : uint8_t
+        {
+            Idle,               // Nothing sealed
+            Sealed,             // Waiting for TessellateSealedFrame
+            Tessellating,
+            Done,
+        };
+
+        // Widest priority range handled by the counting sort
+        static constexpr int MaxCountingSortRange = 1024;
+
+        // Recording the calling thread submits into (nullptr = m_main)
+        static thread_local Recording* t_recording;
+
         LayerConfig m_config;
-        std::vector<DeferredDrawCommand> m_commands[static_cast<size_t>(Layer::COUNT)];
-        int m_popupContextDepth = 0;
+        Recording m_frameRecordings[2];
+        Recording* m_main = &m_frameRecordings[0];  // Main-thread submissions
+        Recording* m_sealed = &m_frameRecordings[1];    // Frame handed to TessellateSealedFrame
+        ImDrawListSplitter m_splitter;
+        LayerStats m_frameStats[static_cast<size_t>(Layer::COUNT)];     // Accumulated during the frame
+        LayerStats m_sealedStats[static_cast<size_t>(Layer::COUNT)];    // Accumulated by TessellateSealedFrame
+        float m_windowFlushTimeMs = 0.0f;                               // FlushWindow() time this frame
+        float m_sealedFlushTimeMs = 0.0f;
+        bool m_sealedStatsPublished = true;
+        LayerFrameStats m_statsHistory[StatsHistoryFrames];             // Ring buffer, published by Flush
+        int m_statsHistoryHead = 0;                                     // Most recent entry
+        int m_statsHistoryCount = 0;
+        std::vector<DeferredDrawCommand> m_sortScratch;
+        std::vector<uint32_t> m_sortCounts;
+
+        // Worker-thread recordings (guarded by m_recordingMutex)
+        std::mutex m_recordingMutex;
+        std::vector<std::unique_ptr<Recording>> m_recordings;      // Finished this frame, merged by Flush
+        std::vector<std::unique_ptr<Recording>> m_recordingPool;   // Reused across frames
+
+        // Sealed frame state (guarded by m_fenceMutex)
+        std::unique_ptr<ImDrawListSharedData> m_sealedSharedData;  // Snapshot, NewFrame may change the live one
+        std::unique_ptr<ImDrawList> m_sealedDrawList;
+        ImTextureID m_sealedTexture = ImTextureID();
+        LayerFence m_sealedFence = 0;
+        SealState m_sealState = SealState::Idle;
+        mutable std::mutex m_fenceMutex;
+        std::condition_variable m_fenceCondition;
+
+        friend class LayerRecordingScope;
+    };
+
+    // Records deferred layer commands made on the calling thread into a private
+    // buffer instead of the shared one. Recordings are merged at Flush in
+    // ascending sequence order (submission order within a recording), after
+    // the main thread's commands, so the result does not depend on thread timing.
+    // The scope must end before EndFrame() of the same frame.
+    //
+    //   workers.Run([&](int panel) {
+    //       EFIGUI::LayerRecordingScope recording(panel);
+    //       DrawPanel(panel);
+    //   });
+    class LayerRecordingScope
+    {
+    public:
+        explicit LayerRecordingScope(uint64_t sequence);
+        ~LayerRecordingScope();
+
+        LayerRecordingScope(const LayerRecordingScope&) = delete;
+        LayerRecordingScope& operator=(const LayerRecordingScope&) = delete;
+
+    private:
+        LayerManager::Recording* m_recording;
+        LayerManager::Recording* m_previous;
     };
 
     // Convenience function
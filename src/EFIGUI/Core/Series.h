@@ -0,0 +1,367 @@
+#pragma once
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define EFIGUI_SERIES_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace EFIGUI
+{
+    // =============================================
+    // Min/Max Kernel
+    // =============================================
+
+    // Fold the minimum and maximum of count contiguous floats into outMin/outMax
+    // (four lanes at a time where SSE2 is available)
+    inline void AccumulateMinMax(const float* values, int count, float& outMin, float& outMax)
+    {
+        int i = 0;
+        float lo = outMin, hi = outMax;
+#ifdef EFIGUI_SERIES_SSE2
+        if (count >= 8)
+        {
+            __m128 vmin = _mm_set1_ps(lo);
+            __m128 vmax = _mm_set1_ps(hi);
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128 v = _mm_loadu_ps(values + i);
+                vmin = _mm_min_ps(vmin, v);
+                vmax = _mm_max_ps(vmax, v);
+            }
+            float lanes[4];
+            _mm_storeu_ps(lanes, vmin);
+            for (float lane : lanes) lo = lane < lo ? lane : lo;
+            _mm_storeu_ps(lanes, vmax);
+            for (float lane : lanes) hi = lane > hi ? lane : hi;
+        }
+#endif
+        for (; i < count; i++)
+        {
+            if (values[i] < lo) lo = values[i];
+            if (values[i] > hi) hi = values[i];
+        }
+        outMin = lo;
+        outMax = hi;
+    }
+
+    // =============================================
+    // Scrolling Series
+    // =============================================
+    // Fixed-capacity ring of samples for plots fed every frame, with optional
+    // per-sample timestamps.
+    //
+    // - Storage is contiguous; GetSpans() unwraps the window into at most two
+    //   runs (oldest first) so consumers iterate linearly, with no % per index
+    // - Min and max over the window are kept in two monotonic queues: Push is
+    //   O(1) amortized and Min/Max are O(1) instead of a rescan
+    // - The ring layout also matches PlotLines' values_offset convention:
+    //   Data() holds Size() samples and Offset() is the oldest
+    //
+    // T must be an arithmetic type.
+
+    template<typename T>
+    struct SeriesSpans
+    {
+        const T* first = nullptr;       // Oldest run
+        int firstCount = 0;
+        const T* second = nullptr;      // Wrapped-around run (newest samples)
+        int secondCount = 0;
+
+        int Size() const { return firstCount + secondCount; }
+    };
+
+    template<typename T>
+    class ScrollingSeries
+    {
+    public:
+        explicit ScrollingSeries(int capacity = 1, bool timestamps = false)
+        {
+            Reset(capacity, timestamps);
+        }
+
+        // Drop all samples and change the window length
+        void Reset(int capacity, bool timestamps = false)
+        {
+            m_capacity = capacity > 0 ? capacity : 1;
+            m_values.assign(m_capacity, T{});
+            m_times.assign(timestamps ? m_capacity : 0, 0.0);
+            m_minQueue.Reset(m_capacity);
+            m_maxQueue.Reset(m_capacity);
+            m_head = 0;
+            m_size = 0;
+            m_pushed = 0;
+        }
+
+        void Clear() { Reset(m_capacity, HasTimestamps()); }
+
+        // Append a sample, evicting the oldest once the window is full
+        void Push(T value)
+        {
+            m_values[m_head] = value;
+            m_head = m_head + 1 == m_capacity ? 0 : m_head + 1;
+            if (m_size < m_capacity)
+                m_size++;
+
+            const uint64_t seq = m_pushed++;
+            const uint64_t oldest = m_pushed > (uint64_t)m_capacity ? m_pushed - m_capacity : 0;
+            m_minQueue.Push(seq, value, oldest, [](T kept, T v) { return kept < v; });
+            m_maxQueue.Push(seq, value, oldest, [](T kept, T v) { return kept > v; });
+        }
+
+        // Append a sample with its timestamp (series created with timestamps)
+        void Push(double time, T value)
+        {
+            if (HasTimestamps())
+                m_times[m_head] = time;
+            Push(value);
+        }
+
+        int Size() const { return m_size; }
+        int Capacity() const { return m_capacity; }
+        bool Empty() const { return m_size == 0; }
+        bool HasTimestamps() const { return !m_times.empty(); }
+
+        // Ring storage and index of the oldest sample (PlotLines values / values_offset)
+        const T* Data() const { return m_values.data(); }
+        int Offset() const { return m_size < m_capacity ? 0 : m_head; }
+
+        // The window as at most two contiguous runs, oldest first
+        SeriesSpans<T> GetSpans() const { return Unwrap(m_values.data()); }
+        SeriesSpans<double> GetTimeSpans() const
+        {
+            return HasTimestamps() ? Unwrap(m_times.data()) : SeriesSpans<double>{};
+        }
+
+        // i-th sample from the oldest
+        T operator[](int i) const { return m_values[Index(i)]; }
+        double GetTime(int i) const { return HasTimestamps() ? m_times[Index(i)] : 0.0; }
+
+        // Newest sample (T{} if empty)
+        T Back() const { return m_size ? m_values[m_head == 0 ? m_capacity - 1 : m_head - 1] : T{}; }
+
+        // Window extrema (numeric_limits max / lowest if empty)
+        T Min() const { return m_size ? m_minQueue.Front() : std::numeric_limits<T>::max(); }
+        T Max() const { return m_size ? m_maxQueue.Front() : std::numeric_limits<T>::lowest(); }
+
+    private:
+        int Index(int i) const
+        {
+            int idx = Offset() + i;
+            return idx >= m_capacity ? idx - m_capacity : idx;
+        }
+
+        template<typename U>
+        SeriesSpans<U> Unwrap(const U* data) const
+        {
+            SeriesSpans<U> spans;
+            const int offset = Offset();
+            spans.first = data + offset;
+            spans.firstCount = m_size - offset;
+            spans.second = data;
+            spans.secondCount = offset;
+            return spans;
+        }
+
+        // Monotonic queue over (sequence, value) in a fixed ring: values are
+        // ordered by the keep predicate from front to back, and entries older
+        // than the window leave from the front
+        struct MonotonicQueue
+        {
+            std::vector<uint64_t> seq;
+            std::vector<T> value;
+            int front = 0;
+            int count = 0;
+
+            void Reset(int capacity)
+            {
+                seq.assign(capacity, 0);
+                value.assign(capacity, T{});
+                front = 0;
+                count = 0;
+            }
+
+            int Slot(int i) const
+            {
+                int slot = front + i;
+                return slot >= (int)seq.size() ? slot - (int)seq.size() : slot;
+            }
+
+            template<typename Keep>
+            void Push(uint64_t s, T v, uint64_t oldest, Keep keep)
+            {
+                while (count > 0 && seq[front] < oldest)
+                {
+                    front = Slot(1);
+                    count--;
+                }
+                while (count > 0 && !keep(value[Slot(count - 1)], v))
+                    count--;
+                int slot = Slot(count);
+                seq[slot] = s;
+                value[slot] = v;
+                count++;
+            }
+
+            T Front() const { return value[front]; }
+        };
+
+        std::vector<T> m_values;
+        std::vector<double> m_times;    // Empty unless created with timestamps
+        MonotonicQueue m_minQueue;
+        MonotonicQueue m_maxQueue;
+        int m_capacity = 1;
+        int m_head = 0;                 // Next write position
+        int m_size = 0;
+        uint64_t m_pushed = 0;          // Samples pushed since Reset (sequence numbers)
+    };
+
+    // Float series as taken directly by PlotLines / PlotHistogram
+    using StreamingSeries = ScrollingSeries<float>;
+
+    // =============================================
+    // Chunked Sources
+    // =============================================
+    // Series that are not float arrays (application containers, other sample
+    // types) are read through a fill callback that converts a run of samples
+    // at a time. Readers pull only the runs they touch, so nothing is
+    // materialized up front.
+
+    // Write samples [start, start + count) of the source in data into out
+    // (start is a storage index; ring offsets are resolved by the reader)
+    using SeriesFill = void (*)(void* data, int start, int count, float* out);
+
+    // Strided array of any arithmetic type, for FillStrided<T>
+    struct StridedSource
+    {
+        const void* values = nullptr;
+        int stride = 0;                 // Bytes between samples
+    };
+
+    template<typename T>
+    void FillStrided(void* data, int start, int count, float* out)
+    {
+        static_assert(std::is_arithmetic<T>::value, "FillStrided: T must be arithmetic");
+        const StridedSource& source = *static_cast<const StridedSource*>(data);
+        const char* p = static_cast<const char*>(source.values) + (ptrdiff_t)start * source.stride;
+        if (source.stride == (int)sizeof(T))
+        {
+            const T* typed = reinterpret_cast<const T*>(p);
+            for (int i = 0; i < count; i++)
+                out[i] = (float)typed[i];
+            return;
+        }
+        for (int i = 0; i < count; i++, p += source.stride)
+            out[i] = (float)*reinterpret_cast<const T*>(p);
+    }
+
+    // Read count logical samples from `start` of a ring of `size` samples whose
+    // oldest sample is at storage index offset (at most two fill calls)
+    inline void ReadSeries(SeriesFill fill, void* data, int size, int offset,
+                           int start, int count, float* out)
+    {
+        int storage = offset + start;
+        if (storage >= size)
+            storage -= size;
+        const int first = count < size - storage ? count : size - storage;
+        fill(data, storage, first, out);
+        if (first < count)
+            fill(data, 0, count - first, out + first);
+    }
+
+    // Random-access sampler over a fill source, reading ChunkSize samples at a
+    // time into a small direct-mapped chunk cache. Two chunks (the default)
+    // cover a forward scan; a look-ahead that reads up to `span` samples past
+    // the oldest one still needed (LTTB: two buckets) needs
+    // CacheChunksForSpan(span) chunks for each chunk to be loaded only once.
+    // The min/max of every loaded chunk is kept, so a pass that visits every
+    // sample also yields the auto-scale range. Usable as a decimation sampler:
+    //   ChunkedReader reader(fill, data, count, offset);
+    //   DecimateMinMax([&](int i) { return reader(i); }, count, ...);
+    class ChunkedReader
+    {
+    public:
+        static constexpr int ChunkSize = 512;
+
+        struct Chunk
+        {
+            int start;
+            int count;
+            float values[ChunkSize];
+
+            bool Contains(int i) const { return i >= start && i < start + count; }
+        };
+
+        static int CacheChunksForSpan(int span) { return (span + ChunkSize - 1) / ChunkSize + 2; }
+
+        // offset must be in [0, size); cache (cacheChunks >= 2, uninitialized
+        // memory is fine) replaces the built-in two chunks
+        ChunkedReader(SeriesFill fill, void* data, int size, int offset,
+                      Chunk* cache = nullptr, int cacheChunks = 0)
+            : m_fill(fill), m_data(data), m_size(size), m_offset(offset)
+        {
+            if (cache && cacheChunks >= 2)
+            {
+                m_chunks = cache;
+                m_slots = cacheChunks;
+            }
+            for (int i = 0; i < m_slots; i++)
+                m_chunks[i].count = 0;
+        }
+
+        // m_chunks may point at m_inline
+        ChunkedReader(const ChunkedReader&) = delete;
+        ChunkedReader& operator=(const ChunkedReader&) = delete;
+
+        // i-th logical sample (from the oldest)
+        float operator()(int i)
+        {
+            const int index = i / ChunkSize;
+            Chunk& chunk = m_chunks[index % m_slots];
+            if (!chunk.Contains(i))
+                Load(chunk, index * ChunkSize);
+            return chunk.values[i - chunk.start];
+        }
+
+        // Samples pulled from the source so far (reloads count again)
+        int GetReadCount() const { return m_readCount; }
+
+        // True once every sample has been read; GetMin/GetMax are then the
+        // whole series' range
+        bool HasReadAll() const { return m_covered >= m_size; }
+        float GetMin() const { return m_min; }
+        float GetMax() const { return m_max; }
+
+    private:
+        void Load(Chunk& chunk, int start)
+        {
+            const int remaining = m_size - start;
+            chunk.start = start;
+            chunk.count = remaining < ChunkSize ? remaining : ChunkSize;
+            ReadSeries(m_fill, m_data, m_size, m_offset, start, chunk.count, chunk.values);
+            AccumulateMinMax(chunk.values, chunk.count, m_min, m_max);
+            m_readCount += chunk.count;
+
+            // Samples [0, m_covered) have all been loaded at least once
+            if (start <= m_covered && start + chunk.count > m_covered)
+                m_covered = start + chunk.count;
+        }
+
+        SeriesFill m_fill;
+        void* m_data;
+        int m_size;
+        int m_offset;
+        int m_readCount = 0;
+        int m_covered = 0;
+        float m_min = FLT_MAX;
+        float m_max = -FLT_MAX;
+        Chunk m_inline[2];
+        Chunk* m_chunks = m_inline;
+        int m_slots = 2;
+    };
+}
@@ -12,6 +12,7 @@
 #include "../Styles/VectorInputStyle.h"
 #include "../Styles/VectorSliderStyle.h"
 #include "../Styles/ImageButtonStyle.h"
+#include "WidgetStore.h"
 #include "imgui.h"
 #include <any>
 #include <atomic>
@@ -102,11 +103,17 @@ public:
         return std::any_cast<StateT&>(it->second);
     }
 
+    /// Get the per-context widget state store (animation state + component side tables)
+    static WidgetStore& GetWidgetStore() {
+        return GetContextStorage().widgets;
+    }
+
 private:
     /// Per-context storage for style stacks and component states
     struct ContextStorage {
         std::unordered_map<std::type_index, std::vector<std::any>> styleStacks;
         std::unordered_map<std::type_index, std::any> componentStates;  // For per-context component state
+        WidgetStore widgets;  // Per-ID widget state (see WidgetStore.h)
     };
 
     /// Get storage for current ImGuiContext (with thread_local caching + epoch invalidation)
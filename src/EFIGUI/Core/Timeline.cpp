@@ -0,0 +1,119 @@
+#include "Timeline.h"
+#include "Animation.h"
+#include "Style.h"
+#include <algorithm>
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        // =============================================
+        // Current Context
+        // =============================================
+
+        TweenPool& GetTweenPool()
+        {
+            return StyleSystem::GetComponentState<TweenPool>();
+        }
+
+        TweenHandle TrackBuilder::Play(float extraDelay) const
+        {
+            return GetTweenPool().Play(*this, extraDelay);
+        }
+
+        TweenHandle TweenFloat(float from, float to, float duration, Ease ease, float delay)
+        {
+            return FloatTrack().Key(0.0f, from).Key(duration, to, ease).Delay(delay).Play();
+        }
+
+        TweenHandle TweenVec2(ImVec2 from, ImVec2 to, float duration, Ease ease, float delay)
+        {
+            return Vec2Track().Key(0.0f, from).Key(duration, to, ease).Delay(delay).Play();
+        }
+
+        TweenHandle TweenColor(ImU32 from, ImU32 to, float duration, Ease ease, float delay)
+        {
+            return ColorTrack().Key(0.0f, from).Key(duration, to, ease).Delay(delay).Play();
+        }
+
+        // =============================================
+        // Reading
+        // =============================================
+
+        float GetFloat(TweenHandle handle, float fallback)
+        {
+            return GetTweenPool().GetFloat(handle, fallback);
+        }
+
+        ImVec2 GetVec2(TweenHandle handle, ImVec2 fallback)
+        {
+            return GetTweenPool().GetVec2(handle, fallback);
+        }
+
+        ImU32 GetColor(TweenHandle handle, ImU32 fallback)
+        {
+            return GetTweenPool().GetColor(handle, fallback);
+        }
+
+        bool IsPlaying(TweenHandle handle)
+        {
+            return GetTweenPool().IsPlaying(handle);
+        }
+
+        void StopTween(TweenHandle handle)
+        {
+            GetTweenPool().Stop(handle);
+        }
+
+        // =============================================
+        // Sequencing
+        // =============================================
+
+        TweenHandle Sequence::Add(const TrackBuilder& track, float start)
+        {
+            m_lastStart = start;
+            m_end = std::max(m_end, start + track.GetDelay() + track.GetDuration());
+            return track.Play(start);
+        }
+
+        TweenHandle Sequence::Then(const TrackBuilder& track, float gap)
+        {
+            return Add(track, m_end + gap);
+        }
+
+        TweenHandle Sequence::With(const TrackBuilder& track, float offset)
+        {
+            return Add(track, m_lastStart + offset);
+        }
+
+        void Stagger(const TrackBuilder& track, int count, float interval, TweenHandle* handles)
+        {
+            GetTweenPool().Stagger(track, count, interval, handles);
+        }
+
+        // =============================================
+        // Pool
+        // =============================================
+
+        void UpdateTweens(float dt)
+        {
+            if (GetTweenPool().Update(dt))
+                RequestRedraw();
+        }
+
+        void ClearTweens()
+        {
+            GetTweenPool().Clear();
+        }
+
+        size_t GetTweenCount()
+        {
+            return GetTweenPool().GetCount();
+        }
+
+        size_t GetTweenCapacity()
+        {
+            return GetTweenPool().GetCapacity();
+        }
+    }
+}
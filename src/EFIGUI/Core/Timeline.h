@@ -0,0 +1,228 @@
+#pragma once
+#include "imgui.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        // =============================================
+        // Tweens and Timelines
+        // =============================================
+        // Keyframe tracks for float, ImVec2 and ImU32 values, each segment with
+        // its own easing. Tracks live in a pooled, index-addressed store owned
+        // by the current ImGui context, which EFIGUI::BeginFrame advances in one
+        // batch (using that context's time source), so widgets only read the
+        // current value.
+        //
+        // Usage:
+        //   static TweenHandle fade;
+        //   if (opened)
+        //       fade = FloatTrack().Key(0.0f, 0.0f).Key(0.25f, 1.0f, Ease::OutQuad).Play();
+        //   float alpha = GetFloat(fade, 1.0f);
+        //
+        // A finished track holds its last value while it is read; once it has
+        // not been read for a frame it is reclaimed and its handle goes stale
+        // (reads then return the fallback).
+
+        enum class Ease : uint8_t
+        {
+            Linear,
+            InQuad,
+            OutQuad,
+            InOutQuad,
+            OutBack,
+            OutElastic
+        };
+
+        // Apply an easing curve to t in [0, 1]
+        float ApplyEase(Ease ease, float t);
+
+        // Generation-checked reference to a pooled track
+        struct TweenHandle
+        {
+            uint32_t index = UINT32_MAX;
+            uint32_t generation = 0;
+
+            bool IsNull() const { return index == UINT32_MAX; }
+        };
+
+        enum class TrackType : uint8_t
+        {
+            Float,
+            Vec2,
+            Color
+        };
+
+        constexpr int MaxTrackKeyframes = 8;
+
+        struct Keyframe
+        {
+            float time = 0.0f;              // Seconds from the track start
+            float value[4] = {};            // Float: x, Vec2: x y, Color: r g b a (0-255)
+            Ease ease = Ease::Linear;       // Easing of the segment ending at this key
+        };
+
+        class TweenPool;
+
+        // Builds a track; Play() copies it into the pool
+        class TrackBuilder
+        {
+        public:
+            explicit TrackBuilder(TrackType type) : m_type(type) {}
+
+            // Keys must be added in increasing time order (at most MaxTrackKeyframes)
+            TrackBuilder& Key(float time, float value, Ease ease = Ease::Linear);
+            TrackBuilder& Key(float time, ImVec2 value, Ease ease = Ease::Linear);
+            TrackBuilder& Key(float time, ImU32 value, Ease ease = Ease::Linear);
+
+            // Wait before the first key (added to any sequence offset)
+            TrackBuilder& Delay(float seconds) { m_delay = seconds; return *this; }
+
+            // Restart from the first key after the last one (never finishes)
+            TrackBuilder& Loop(bool loop = true) { m_loop = loop; return *this; }
+
+            // Start playing in the current context's pool; extraDelay is added to Delay()
+            TweenHandle Play(float extraDelay = 0.0f) const;
+
+            // Time of the last key (the track's length excluding delay)
+            float GetDuration() const { return m_keyCount > 0 ? m_keys[m_keyCount - 1].time : 0.0f; }
+            float GetDelay() const { return m_delay; }
+
+        private:
+            friend class TweenPool;
+
+            TrackBuilder& AddKey(float time, const float* value, int components, Ease ease);
+
+            TrackType m_type;
+            uint8_t m_keyCount = 0;
+            bool m_loop = false;
+            float m_delay = 0.0f;
+            Keyframe m_keys[MaxTrackKeyframes];
+        };
+
+        inline TrackBuilder FloatTrack() { return TrackBuilder(TrackType::Float); }
+        inline TrackBuilder Vec2Track() { return TrackBuilder(TrackType::Vec2); }
+        inline TrackBuilder ColorTrack() { return TrackBuilder(TrackType::Color); }
+
+        // Single-segment shortcuts
+        TweenHandle TweenFloat(float from, float to, float duration, Ease ease = Ease::OutQuad, float delay = 0.0f);
+        TweenHandle TweenVec2(ImVec2 from, ImVec2 to, float duration, Ease ease = Ease::OutQuad, float delay = 0.0f);
+        TweenHandle TweenColor(ImU32 from, ImU32 to, float duration, Ease ease = Ease::OutQuad, float delay = 0.0f);
+
+        // Current value (fallback if the handle is null or stale)
+        float GetFloat(TweenHandle handle, float fallback = 0.0f);
+        ImVec2 GetVec2(TweenHandle handle, ImVec2 fallback = ImVec2(0.0f, 0.0f));
+        ImU32 GetColor(TweenHandle handle, ImU32 fallback = 0);
+
+        // True while the track exists and has not reached its last key
+        bool IsPlaying(TweenHandle handle);
+
+        // Release a track now (its handle goes stale)
+        void StopTween(TweenHandle handle);
+
+        // =============================================
+        // Sequencing
+        // =============================================
+
+        // Lays tracks out on a shared clock starting at the time it is created
+        // Usage: Sequence seq; seq.Then(slide); seq.With(fade); seq.Then(glow, 0.1f);
+        class Sequence
+        {
+        public:
+            // Start after everything added so far (+ gap)
+            TweenHandle Then(const TrackBuilder& track, float gap = 0.0f);
+
+            // Start together with the previous track (+ offset)
+            TweenHandle With(const TrackBuilder& track, float offset = 0.0f);
+
+            // Time at which the sequence ends
+            float GetEnd() const { return m_end; }
+
+        private:
+            TweenHandle Add(const TrackBuilder& track, float start);
+
+            float m_lastStart = 0.0f;
+            float m_end = 0.0f;
+        };
+
+        // Play the same track count times, each interval seconds after the
+        // previous one (e.g. staggered card entrance); handles may be null
+        void Stagger(const TrackBuilder& track, int count, float interval, TweenHandle* handles = nullptr);
+
+        // =============================================
+        // Pool
+        // =============================================
+
+        // Index-addressed store of playing tracks; freed slots are reused and
+        // bump their generation so old handles go stale. Each ImGui context
+        // owns one (GetTweenPool()); the free functions in this header use it.
+        class TweenPool
+        {
+        public:
+            TweenHandle Play(const TrackBuilder& track, float extraDelay = 0.0f);
+            void Stagger(const TrackBuilder& track, int count, float interval, TweenHandle* handles = nullptr);
+
+            // Current value (fallback if the handle is null or stale); reading
+            // keeps a finished track alive for another update
+            float GetFloat(TweenHandle handle, float fallback = 0.0f);
+            ImVec2 GetVec2(TweenHandle handle, ImVec2 fallback = ImVec2(0.0f, 0.0f));
+            ImU32 GetColor(TweenHandle handle, ImU32 fallback = 0);
+
+            bool IsPlaying(TweenHandle handle) const;
+            void Stop(TweenHandle handle);
+
+            // Advance every track by dt and reclaim finished tracks not read
+            // since the previous update. Returns true if any track advanced.
+            bool Update(float dt);
+
+            void Clear();
+            size_t GetCount() const { return m_liveCount; }
+            size_t GetCapacity() const { return m_tracks.size(); }
+
+        private:
+            struct Track
+            {
+                uint32_t generation = 0;
+                bool live = false;
+                bool loop = false;
+                bool finished = false;
+                TrackType type = TrackType::Float;
+                uint8_t keyCount = 0;
+                uint8_t segment = 0;            // Key index the current segment ends at
+                float delay = 0.0f;
+                float elapsed = 0.0f;
+                uint32_t lastRead = 0;          // Update count of the last read
+                float value[4] = {};
+                Keyframe keys[MaxTrackKeyframes];
+            };
+
+            Track* Resolve(TweenHandle handle);
+            const Track* Resolve(TweenHandle handle) const;
+            const Track* ResolveRead(TweenHandle handle);
+            void Release(uint32_t index);
+            static void Evaluate(Track& track);
+
+            std::vector<Track> m_tracks;
+            std::vector<uint32_t> m_freeIndices;
+            size_t m_liveCount = 0;
+            uint32_t m_updateCount = 0;
+        };
+
+        // The current ImGui context's pool
+        TweenPool& GetTweenPool();
+
+        // Advance every track by dt and reclaim finished, unread tracks
+        // (called by EFIGUI::BeginFrame with GetDeltaTime())
+        void UpdateTweens(float dt);
+
+        // Release all tracks
+        void ClearTweens();
+
+        // Live tracks / pool capacity
+        size_t GetTweenCount();
+        size_t GetTweenCapacity();
+    }
+}
@@ -0,0 +1,272 @@
+#include "Timeline.h"
+#include <algorithm>
+#include <cmath>
+
+namespace EFIGUI
+{
+    namespace Animation
+    {
+        namespace
+        {
+            int ComponentCount(TrackType type)
+            {
+                switch (type)
+                {
+                case TrackType::Float: return 1;
+                case TrackType::Vec2:  return 2;
+                case TrackType::Color: return 4;
+                }
+                return 1;
+            }
+
+            float ClampChannel(float v)
+            {
+                return v < 0.0f ? 0.0f : (v > 255.0f ? 255.0f : v);
+            }
+        }
+
+        // =============================================
+        // Track Builder
+        // =============================================
+
+        TrackBuilder& TrackBuilder::AddKey(float time, const float* value, int components, Ease ease)
+        {
+            IM_ASSERT(m_keyCount < MaxTrackKeyframes && "EFIGUI: too many keyframes (MaxTrackKeyframes)");
+            IM_ASSERT((m_keyCount == 0 || time >= m_keys[m_keyCount - 1].time) && "EFIGUI: keyframes must be in time order");
+            if (m_keyCount >= MaxTrackKeyframes)
+                return *this;
+
+            Keyframe& key = m_keys[m_keyCount++];
+            key.time = time;
+            key.ease = ease;
+            for (int c = 0; c < components; c++)
+                key.value[c] = value[c];
+            return *this;
+        }
+
+        TrackBuilder& TrackBuilder::Key(float time, float value, Ease ease)
+        {
+            IM_ASSERT(m_type == TrackType::Float);
+            return AddKey(time, &value, 1, ease);
+        }
+
+        TrackBuilder& TrackBuilder::Key(float time, ImVec2 value, Ease ease)
+        {
+            IM_ASSERT(m_type == TrackType::Vec2);
+            float v[2] = { value.x, value.y };
+            return AddKey(time, v, 2, ease);
+        }
+
+        TrackBuilder& TrackBuilder::Key(float time, ImU32 value, Ease ease)
+        {
+            IM_ASSERT(m_type == TrackType::Color);
+            float v[4] = {
+                (float)((value >> IM_COL32_R_SHIFT) & 0xFF),
+                (float)((value >> IM_COL32_G_SHIFT) & 0xFF),
+                (float)((value >> IM_COL32_B_SHIFT) & 0xFF),
+                (float)((value >> IM_COL32_A_SHIFT) & 0xFF)
+            };
+            return AddKey(time, v, 4, ease);
+        }
+
+        // =============================================
+        // Tween Pool
+        // =============================================
+
+        TweenPool::Track* TweenPool::Resolve(TweenHandle handle)
+        {
+            if (handle.index >= m_tracks.size())
+                return nullptr;
+            Track& track = m_tracks[handle.index];
+            if (!track.live || track.generation != handle.generation)
+                return nullptr;
+            return &track;
+        }
+
+        const TweenPool::Track* TweenPool::Resolve(TweenHandle handle) const
+        {
+            return const_cast<TweenPool*>(this)->Resolve(handle);
+        }
+
+        // Resolve for reading: keeps a finished track alive another update
+        const TweenPool::Track* TweenPool::ResolveRead(TweenHandle handle)
+        {
+            Track* track = Resolve(handle);
+            if (track)
+                track->lastRead = m_updateCount;
+            return track;
+        }
+
+        void TweenPool::Release(uint32_t index)
+        {
+            Track& track = m_tracks[index];
+            track.live = false;
+            track.generation++;
+            m_freeIndices.push_back(index);
+            m_liveCount--;
+        }
+
+        // Evaluate the track at its current elapsed time
+        void TweenPool::Evaluate(Track& track)
+        {
+            const int components = ComponentCount(track.type);
+            const float duration = track.keys[track.keyCount - 1].time;
+            float local = track.elapsed - track.delay;
+
+            if (track.loop && duration > 0.0f && local >= duration)
+            {
+                local = std::fmod(local, duration);
+                track.segment = 0;
+            }
+
+            const Keyframe* from = &track.keys[0];
+            const Keyframe* to = from;
+            if (local <= from->time)
+            {
+                // Before the first key: hold it
+            }
+            else if (local >= duration)
+            {
+                from = to = &track.keys[track.keyCount - 1];
+                track.finished = !track.loop;
+            }
+            else
+            {
+                // Segments only move forward between loops
+                int segment = std::max<int>(track.segment, 1);
+                while (segment < track.keyCount - 1 && track.keys[segment].time <= local)
+                    segment++;
+                track.segment = static_cast<uint8_t>(segment);
+                from = &track.keys[segment - 1];
+                to = &track.keys[segment];
+            }
+
+            if (from == to)
+            {
+                for (int c = 0; c < components; c++)
+                    track.value[c] = from->value[c];
+                return;
+            }
+
+            float span = to->time - from->time;
+            float t = span > 0.0f ? (local - from->time) / span : 1.0f;
+            float e = ApplyEase(to->ease, t);
+            for (int c = 0; c < components; c++)
+                track.value[c] = from->value[c] + (to->value[c] - from->value[c]) * e;
+        }
+
+        TweenHandle TweenPool::Play(const TrackBuilder& builder, float extraDelay)
+        {
+            if (builder.m_keyCount == 0)
+                return TweenHandle{};
+
+            uint32_t index;
+            if (!m_freeIndices.empty())
+            {
+                index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(m_tracks.size());
+                m_tracks.emplace_back();
+            }
+
+            Track& track = m_tracks[index];
+            track.live = true;
+            track.loop = builder.m_loop;
+            track.finished = false;
+            track.type = builder.m_type;
+            track.keyCount = builder.m_keyCount;
+            track.segment = 0;
+            track.delay = builder.m_delay + extraDelay;
+            track.elapsed = 0.0f;
+            track.lastRead = m_updateCount;
+            std::copy(builder.m_keys, builder.m_keys + builder.m_keyCount, track.keys);
+            Evaluate(track);
+            m_liveCount++;
+
+            return TweenHandle{ index, track.generation };
+        }
+
+        void TweenPool::Stagger(const TrackBuilder& track, int count, float interval, TweenHandle* handles)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                TweenHandle handle = Play(track, interval * i);
+                if (handles)
+                    handles[i] = handle;
+            }
+        }
+
+        float TweenPool::GetFloat(TweenHandle handle, float fallback)
+        {
+            const Track* track = ResolveRead(handle);
+            return track ? track->value[0] : fallback;
+        }
+
+        ImVec2 TweenPool::GetVec2(TweenHandle handle, ImVec2 fallback)
+        {
+            const Track* track = ResolveRead(handle);
+            return track ? ImVec2(track->value[0], track->value[1]) : fallback;
+        }
+
+        ImU32 TweenPool::GetColor(TweenHandle handle, ImU32 fallback)
+        {
+            const Track* track = ResolveRead(handle);
+            if (!track)
+                return fallback;
+            return IM_COL32((int)(ClampChannel(track->value[0]) + 0.5f),
+                            (int)(ClampChannel(track->value[1]) + 0.5f),
+                            (int)(ClampChannel(track->value[2]) + 0.5f),
+                            (int)(ClampChannel(track->value[3]) + 0.5f));
+        }
+
+        bool TweenPool::IsPlaying(TweenHandle handle) const
+        {
+            const Track* track = Resolve(handle);
+            return track && !track->finished;
+        }
+
+        void TweenPool::Stop(TweenHandle handle)
+        {
+            if (Resolve(handle))
+                Release(handle.index);
+        }
+
+        bool TweenPool::Update(float dt)
+        {
+            uint32_t previous = m_updateCount++;
+            bool advanced = false;
+
+            for (uint32_t i = 0; i < m_tracks.size(); i++)
+            {
+                Track& track = m_tracks[i];
+                if (!track.live)
+                    continue;
+
+                // Finished tracks stay while someone reads them
+                if (track.finished)
+                {
+                    if (track.lastRead != previous)
+                        Release(i);
+                    continue;
+                }
+
+                track.elapsed += dt;
+                Evaluate(track);
+                advanced = true;
+            }
+            return advanced;
+        }
+
+        void TweenPool::Clear()
+        {
+            for (uint32_t i = 0; i < m_tracks.size(); i++)
+            {
+                if (m_tracks[i].live)
+                    Release(i);
+            }
+        }
+    }
+}
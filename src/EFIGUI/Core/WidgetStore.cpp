@@ -0,0 +1,82 @@
+#include "WidgetStore.h"
+#include "Style.h"
+#include <atomic>
+
+namespace EFIGUI
+{
+    size_t WidgetStore::NextSideTypeId()
+    {
+        static std::atomic<size_t> s_nextId{0};
+        size_t id = s_nextId.fetch_add(1, std::memory_order_relaxed);
+        IM_ASSERT(id < MaxWidgetSideTables && "EFIGUI: too many widget side table types (raise MaxWidgetSideTables)");
+        return id;
+    }
+
+    WidgetEntry& WidgetStore::Get(ImGuiID id)
+    {
+        WidgetEntry& entry = m_entries.GetOrCreate(id);
+        entry.lastUsedFrame = ImGui::GetFrameCount();
+        return entry;
+    }
+
+    void WidgetStore::ReleaseSides(WidgetEntry& entry)
+    {
+        for (size_t i = 0; i < MaxWidgetSideTables; i++)
+        {
+            if (entry.side[i] != 0)
+            {
+                m_sideTables[i]->Release(entry.side[i] - 1);
+                entry.side[i] = 0;
+            }
+        }
+    }
+
+    size_t WidgetStore::Prune(int maxIdleFrames)
+    {
+        int currentFrame = ImGui::GetFrameCount();
+        return m_entries.RemoveIf([&](ImGuiID, WidgetEntry& entry) {
+            if (currentFrame - entry.lastUsedFrame <= maxIdleFrames)
+                return false;
+            ReleaseSides(entry);
+            return true;
+        });
+    }
+
+    size_t WidgetStore::PruneIncremental(int maxIdleFrames)
+    {
+        int currentFrame = ImGui::GetFrameCount();
+        return m_entries.RemoveIfStep(m_pruneCursor, PruneSweepFrames, [&](ImGuiID, WidgetEntry& entry) {
+            if (currentFrame - entry.lastUsedFrame <= maxIdleFrames)
+                return false;
+            ReleaseSides(entry);
+            return true;
+        });
+    }
+
+    void WidgetStore::Clear()
+    {
+        m_entries.Clear();
+        for (auto& table : m_sideTables)
+        {
+            if (table)
+                table->Clear();
+        }
+        m_pruneCursor = 0;
+    }
+
+    size_t WidgetStore::GetMemoryBytes() const
+    {
+        size_t bytes = m_entries.GetMemoryBytes();
+        for (const auto& table : m_sideTables)
+        {
+            if (table)
+                bytes += table->GetMemoryBytes();
+        }
+        return bytes;
+    }
+
+    WidgetStore& GetWidgetStore()
+    {
+        return StyleSystem::GetWidgetStore();
+    }
+}
@@ -0,0 +1,196 @@
+#pragma once
+#include "imgui.h"
+#include "Animation.h"
+#include "IdTable.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace EFIGUI
+{
+    // =============================================
+    // Widget Store
+    // =============================================
+    // One entry per ImGuiID holding the widget's animation state and the frame
+    // it was last used. Components attach typed side tables on demand (Drag
+    // change feedback, NumericInput text buffers), so a widget pays a single
+    // hash lookup per frame for all of its cached state.
+    //
+    // - Owned per ImGuiContext (StyleSystem storage); access via GetWidgetStore()
+    // - Pruned once, incrementally, from BeginFrame; a pruned entry releases
+    //   its side table slots with it
+    // - Entry and side value references stay valid until the entry is pruned,
+    //   the side value detached, or the store cleared
+
+    constexpr size_t MaxWidgetSideTables = 8;
+
+    struct WidgetEntry
+    {
+        Animation::WidgetState anim;
+        int lastUsedFrame = 0;                      // Frame of the last Get (for pruning)
+        uint32_t side[MaxWidgetSideTables] = {};    // Side table slot + 1 (0 = not attached)
+    };
+
+    class WidgetStore
+    {
+    public:
+        // Calls over which PruneIncremental sweeps every entry
+        static constexpr size_t PruneSweepFrames = 60;
+
+        WidgetStore() = default;
+        WidgetStore(const WidgetStore&) = delete;
+        WidgetStore& operator=(const WidgetStore&) = delete;
+        WidgetStore(WidgetStore&&) noexcept = default;
+        WidgetStore& operator=(WidgetStore&&) noexcept = default;
+
+        // Get or create the entry for an id and mark it used this frame
+        WidgetEntry& Get(ImGuiID id);
+
+        // Find an existing entry (nullptr if absent); does not mark it used
+        WidgetEntry* Find(ImGuiID id) { return m_entries.Find(id); }
+
+        // Get the entry's T side value, attaching a default-constructed one if absent
+        template<typename T>
+        T& GetSide(WidgetEntry& entry)
+        {
+            SideTable<T>& table = GetTable<T>();
+            uint32_t& slot = entry.side[SideTypeId<T>()];
+            if (slot == 0)
+                slot = table.Allocate() + 1;
+            return table.values[slot - 1];
+        }
+
+        // The entry's T side value, or nullptr if not attached
+        template<typename T>
+        T* FindSide(const WidgetEntry& entry)
+        {
+            uint32_t slot = entry.side[SideTypeId<T>()];
+            return slot == 0 ? nullptr : &GetTable<T>().values[slot - 1];
+        }
+
+        // Detach T from every entry for which pred(entry, value) returns true
+        // (the entries themselves stay); returns the number detached
+        template<typename T, typename Pred>
+        size_t DetachSideIf(Pred pred)
+        {
+            size_t typeId = SideTypeId<T>();
+            if (!m_sideTables[typeId])
+                return 0;
+
+            SideTable<T>& table = GetTable<T>();
+            size_t detached = 0;
+            m_entries.ForEach([&](ImGuiID, WidgetEntry& entry) {
+                uint32_t slot = entry.side[typeId];
+                if (slot != 0 && pred(static_cast<const WidgetEntry&>(entry), table.values[slot - 1]))
+                {
+                    table.Release(slot - 1);
+                    entry.side[typeId] = 0;
+                    detached++;
+                }
+            });
+            return detached;
+        }
+
+        // Remove entries not used for more than maxIdleFrames (full sweep)
+        size_t Prune(int maxIdleFrames);
+
+        // Prune a bounded slice of the entries; a full sweep completes every
+        // PruneSweepFrames calls (called by EFIGUI::BeginFrame)
+        size_t PruneIncremental(int maxIdleFrames);
+
+        void Clear();
+
+        size_t Size() const { return m_entries.Size(); }
+
+        // Entries with a T side value attached
+        template<typename T>
+        size_t GetSideCount() const
+        {
+            const auto& table = m_sideTables[SideTypeId<T>()];
+            return table ? table->Count() : 0;
+        }
+
+        // Heap memory held by the entries and all side tables
+        size_t GetMemoryBytes() const;
+
+    private:
+        struct SideTableBase
+        {
+            virtual ~SideTableBase() = default;
+            virtual void Release(uint32_t slot) = 0;
+            virtual void Clear() = 0;
+            virtual size_t Count() const = 0;
+            virtual size_t GetMemoryBytes() const = 0;
+        };
+
+        // Values in a deque so references survive later attachments
+        template<typename T>
+        struct SideTable final : SideTableBase
+        {
+            std::deque<T> values;
+            std::vector<uint32_t> freeSlots;
+
+            uint32_t Allocate()
+            {
+                if (!freeSlots.empty())
+                {
+                    uint32_t slot = freeSlots.back();
+                    freeSlots.pop_back();
+                    return slot;
+                }
+                values.emplace_back();
+                return static_cast<uint32_t>(values.size() - 1);
+            }
+
+            // Released values are reset so they drop any heap memory they own
+            void Release(uint32_t slot) override
+            {
+                values[slot] = T{};
+                freeSlots.push_back(slot);
+            }
+
+            void Clear() override
+            {
+                values.clear();
+                freeSlots.clear();
+            }
+
+            size_t Count() const override { return values.size() - freeSlots.size(); }
+
+            size_t GetMemoryBytes() const override
+            {
+                return values.size() * sizeof(T) + freeSlots.capacity() * sizeof(uint32_t);
+            }
+        };
+
+        // Side table ids are assigned on first use of each type
+        static size_t NextSideTypeId();
+
+        template<typename T>
+        static size_t SideTypeId()
+        {
+            static const size_t id = NextSideTypeId();
+            return id;
+        }
+
+        template<typename T>
+        SideTable<T>& GetTable()
+        {
+            auto& table = m_sideTables[SideTypeId<T>()];
+            if (!table)
+                table = std::make_unique<SideTable<T>>();
+            return static_cast<SideTable<T>&>(*table);
+        }
+
+        void ReleaseSides(WidgetEntry& entry);
+
+        IdTable<WidgetEntry> m_entries;
+        std::unique_ptr<SideTableBase> m_sideTables[MaxWidgetSideTables];
+        size_t m_pruneCursor = 0;
+    };
+
+    // Widget store of the current ImGuiContext
+    WidgetStore& GetWidgetStore();
+}
@@ -5,6 +5,13 @@
 
 namespace EFIGUI {
 
+/// How PlotLines reduces series with more than two samples per pixel column
+enum class PlotDecimation {
+    None,       // Draw every sample
+    MinMax,     // Per-column min/max envelope (keeps every spike)
+    LTTB        // Largest-Triangle-Three-Buckets (2 points per column, smoother shape)
+};
+
 /// Style configuration for Plot components (PlotLines, PlotHistogram)
 struct PlotStyle {
     // Frame colors
@@ -23,6 +30,7 @@ struct PlotStyle {
     ImU32 lineColor = CyberpunkTheme::Colors::AccentCyan;
     ImU32 lineGlowColor = CyberpunkTheme::Colors::AccentCyanGlow;
     float lineThickness = 2.0f;
+    PlotDecimation decimation = PlotDecimation::MinMax;
 
     // Histogram colors
     ImU32 histogramColor = CyberpunkTheme::Colors::AccentCyan;
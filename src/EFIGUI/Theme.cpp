@@ -404,6 +404,11 @@ namespace EFIGUI
             if (ImGui::CollapsingHeader("Draw"))
             {
                 auto& dr = config.draw;
+                static const char* glowQualityNames[] = { "Layered", "Low", "Medium", "High" };
+                int glowQuality = (int)dr.glowQuality;
+                if (ImGui::Combo("Glow Quality", &glowQuality, glowQualityNames, IM_ARRAYSIZE(glowQualityNames)))
+                    dr.glowQuality = (GlowQuality)glowQuality;
+                ImGui::Separator();
                 ImGui::Text("RectGlow:");
                 ImGui::DragFloat("Glow Min Intensity", &dr.glowMinIntensity, 0.01f, 0.0f, 0.5f);
                 ImGui::DragInt("Glow Layer Count", &dr.glowLayerCount, 0.2f, 1, 10);
@@ -424,6 +429,7 @@ namespace EFIGUI
                 ImGui::DragInt("Min Edge Segments", &dr.marqueeMinEdgeSegments, 0.2f, 1, 10);
                 ImGui::DragInt("Min Alpha", &dr.marqueeMinAlpha, 1.0f, 0, 100);
                 ImGui::DragFloat("Hover Threshold", &dr.marqueeHoverThreshold, 0.05f, 0.0f, 1.0f);
+                ImGui::Checkbox("Single Polyline", &dr.marqueePolyline);
                 ImGui::Separator();
                 ImGui::Text("Glassmorphism:");
                 ImGui::DragInt("Glass Blur Alpha", &dr.glassBlurAlpha, 1.0f, 0, 255);
@@ -534,8 +534,20 @@ namespace EFIGUI
         int glowAnimAlpha = 60;             // Alpha for glow animation
     };
 
+    // Glow rendering: stacked shapes, or one feathered mesh at a tessellation level
+    enum class GlowQuality
+    {
+        Layered,        // One rect/circle per glow layer (original look)
+        Low,            // Feathered mesh, 4 segments per corner
+        Medium,         // Feathered mesh, 8 segments per corner
+        High            // Feathered mesh, 16 segments per corner
+    };
+
     struct DrawTheme
     {
+        // Glow rendering (RectGlow, GlowLayers, GlowLayersCircle)
+        GlowQuality glowQuality = GlowQuality::Layered; // Layered = stacked shapes, Low-High = one feathered mesh (opt-in)
+
         // RectGlow
         float glowMinIntensity  = 0.01f;            // Minimum intensity to draw glow
         int   glowLayerCount    = 4;                // Number of glow layers
@@ -556,6 +568,7 @@ namespace EFIGUI
         int   marqueeMinEdgeSegments = 2;           // Minimum segments per edge
         int   marqueeMinAlpha   = 25;               // Minimum alpha value
         float marqueeHoverThreshold = 0.1f;         // Hover intensity threshold
+        bool  marqueePolyline   = true;             // One per-vertex-alpha polyline (false = one line per segment)
 
         // Glassmorphism
         int   glassBlurAlpha    = 200;              // Blur alpha value
@@ -474,3 +474,810 @@ TEST_CASE("InputConfig Builder Pattern") {
         CHECK(cfg.focusBorderColor.value() == IM_COL32(0, 245, 255, 255));
     }
 }
+
+// =============================================
+// Frame Arena Tests
+// =============================================
+
+#include "EFIGUI/Core/FrameArena.h"
+#include <cstdint>
+#include <cstring>
+
+TEST_CASE("FrameArena Allocation") {
+    using namespace EFIGUI;
+
+    SUBCASE("Alignment") {
+        FrameArena arena(256);
+        arena.Allocate(1, 1);
+        void* p = arena.Allocate(16, 16);
+        CHECK(reinterpret_cast<uintptr_t>(p) % 16 == 0);
+    }
+
+    SUBCASE("String Helpers") {
+        FrameArena arena(256);
+        const char* copy = arena.CopyString("glow");
+        CHECK(std::strcmp(copy, "glow") == 0);
+
+        const char* formatted = arena.Format("##%s_%d", "value", 7);
+        CHECK(std::strcmp(formatted, "##value_7") == 0);
+    }
+
+    SUBCASE("Overflow Chains Blocks Then Coalesces On Reset") {
+        FrameArena arena(64);
+        for (int i = 0; i < 8; ++i)
+            arena.AllocateArray<float>(16);
+        CHECK(arena.GetBlockCount() > 1);
+
+        size_t peak = arena.GetUsedBytes();
+        arena.Reset();
+        CHECK(arena.GetBlockCount() == 1);
+        CHECK(arena.GetUsedBytes() == 0);
+        CHECK(arena.GetHighWaterMark() == peak);
+        CHECK(arena.GetCapacity() >= peak);
+
+        // A warm arena serves the same workload from a single block
+        for (int i = 0; i < 8; ++i)
+            arena.AllocateArray<float>(16);
+        CHECK(arena.GetBlockCount() == 1);
+    }
+}
+
+// =============================================
+// IdTable Tests (pure container, no ImGui context)
+// =============================================
+
+#include "EFIGUI/Core/IdTable.h"
+
+TEST_CASE("IdTable Storage") {
+    using namespace EFIGUI;
+
+    struct Value { int frame = 0; float anim = 0.0f; };
+
+    SUBCASE("Insert And Find") {
+        IdTable<Value> table;
+        table.GetOrCreate(42).frame = 7;
+        CHECK(table.Size() == 1);
+        REQUIRE(table.Find(42) != nullptr);
+        CHECK(table.Find(42)->frame == 7);
+        CHECK(table.Find(43) == nullptr);
+
+        // Zero is a valid key
+        table.GetOrCreate(0).frame = 3;
+        CHECK(table.Find(0)->frame == 3);
+    }
+
+    SUBCASE("References Survive Growth") {
+        IdTable<Value, 16> table;
+        Value& first = table.GetOrCreate(1);
+        first.frame = 99;
+        for (uint32_t id = 2; id < 5000; ++id)
+            table.GetOrCreate(id).frame = static_cast<int>(id);
+        CHECK(&first == table.Find(1));
+        CHECK(first.frame == 99);
+        CHECK(table.Size() == 4999);
+    }
+
+    SUBCASE("Remove Keeps Probe Chains Intact") {
+        IdTable<Value> table;
+        for (uint32_t id = 0; id < 1000; ++id)
+            table.GetOrCreate(id * 64).frame = static_cast<int>(id);
+        for (uint32_t id = 0; id < 1000; id += 2)
+            CHECK(table.Remove(id * 64));
+        CHECK(table.Size() == 500);
+        for (uint32_t id = 0; id < 1000; ++id)
+        {
+            const Value* v = table.Find(id * 64);
+            if (id % 2 == 0)
+                CHECK(v == nullptr);
+            else
+                CHECK((v != nullptr && v->frame == static_cast<int>(id)));
+        }
+    }
+
+    SUBCASE("RemoveIf Recycles Slots") {
+        IdTable<Value> table;
+        for (uint32_t id = 1; id <= 100; ++id)
+            table.GetOrCreate(id).frame = static_cast<int>(id);
+        size_t removed = table.RemoveIf([](uint32_t, const Value& v) { return v.frame <= 60; });
+        CHECK(removed == 60);
+        CHECK(table.Size() == 40);
+
+        size_t slots = table.GetSlotCount();
+        for (uint32_t id = 1000; id < 1060; ++id)
+            CHECK(table.GetOrCreate(id).frame == 0);  // Reused slots are reset
+        CHECK(table.GetSlotCount() == slots);
+    }
+
+    SUBCASE("Clear") {
+        IdTable<Value> table;
+        for (uint32_t id = 1; id <= 10; ++id)
+            table.GetOrCreate(id);
+        table.Clear();
+        CHECK(table.Empty());
+        CHECK(table.Find(5) == nullptr);
+    }
+
+    SUBCASE("RemoveIfStep Sweeps Incrementally") {
+        IdTable<Value> table;
+        for (uint32_t id = 1; id <= 6400; ++id)
+            table.GetOrCreate(id).frame = static_cast<int>(id % 2);
+
+        // 6400 slots over 10 steps: 640 slots per call
+        size_t cursor = 0;
+        size_t removed = table.RemoveIfStep(cursor, 10, [](uint32_t, const Value& v) { return v.frame == 0; });
+        CHECK(cursor == 640);
+        CHECK(removed == 320);
+
+        for (int step = 1; step < 10; ++step)
+            removed += table.RemoveIfStep(cursor, 10, [](uint32_t, const Value& v) { return v.frame == 0; });
+        CHECK(removed == 3200);
+        CHECK(table.Size() == 3200);
+        CHECK(cursor == table.GetSlotCount());
+
+        // Wraps back to the start
+        table.RemoveIfStep(cursor, 10, [](uint32_t, const Value&) { return false; });
+        CHECK(cursor == 640);
+    }
+
+    SUBCASE("Copy Is Deep") {
+        IdTable<Value, 16> table;
+        for (uint32_t id = 1; id <= 40; ++id)
+            table.GetOrCreate(id).frame = static_cast<int>(id);
+        IdTable<Value, 16> copy(table);
+        copy.GetOrCreate(7).frame = -1;
+        copy.Remove(8);
+        CHECK(table.Find(7)->frame == 7);
+        CHECK(table.Contains(8));
+        CHECK(copy.Size() == 39);
+        CHECK(copy.Find(40)->frame == 40);
+    }
+}
+
+// =============================================
+// Series Decimation Tests (pure functions, no ImGui context)
+// =============================================
+
+#include "EFIGUI/Core/Decimation.h"
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("Series Decimation") {
+    using namespace EFIGUI;
+
+    SUBCASE("MinMax Keeps Spikes In Order") {
+        std::vector<float> data(1000, 0.0f);
+        data[123] = 5.0f;
+        data[130] = -3.0f;
+        data[901] = 9.0f;
+        auto sample = [&](int i) { return data[i]; };
+
+        float index[20], value[20];
+        int n = DecimateMinMax(sample, 1000, 10, index, value);
+        CHECK(n <= 20);
+
+        bool sawHigh = false, sawLow = false, sawPeak = false;
+        for (int i = 0; i < n; ++i) {
+            if (i > 0) CHECK(index[i] > index[i - 1]);
+            if (value[i] == 5.0f) { sawHigh = true; CHECK(index[i] == 123.0f); }
+            if (value[i] == -3.0f) sawLow = true;
+            if (value[i] == 9.0f) sawPeak = true;
+        }
+        CHECK(sawHigh);
+        CHECK(sawLow);
+        CHECK(sawPeak);
+    }
+
+    SUBCASE("MinMax Flat Bucket Emits One Point") {
+        auto sample = [](int) { return 1.0f; };
+        float index[8], value[8];
+        CHECK(DecimateMinMax(sample, 400, 4, index, value) == 4);
+        CHECK(index[1] == 100.0f);
+    }
+
+    SUBCASE("LTTB Exact Point Count With Endpoints") {
+        auto sample = [](int i) { return std::sin(i * 0.01f); };
+        std::vector<float> index(100), value(100);
+        int n = DecimateLTTB(sample, 100000, 100, index.data(), value.data());
+        CHECK(n == 100);
+        CHECK(index.front() == 0.0f);
+        CHECK(index.back() == 99999.0f);
+        for (int i = 1; i < n; ++i)
+            CHECK(index[i] > index[i - 1]);
+    }
+
+    SUBCASE("LTTB Picks The Outlier") {
+        std::vector<float> data(300, 0.0f);
+        data[150] = 10.0f;
+        auto sample = [&](int i) { return data[i]; };
+        float index[10], value[10];
+        int n = DecimateLTTB(sample, 300, 10, index, value);
+        bool found = false;
+        for (int i = 0; i < n; ++i)
+            found = found || (index[i] == 150.0f && value[i] == 10.0f);
+        CHECK(found);
+    }
+
+    SUBCASE("Short Series Pass Through") {
+        auto sample = [](int i) { return (float)i * 2.0f; };
+        float index[8], value[8];
+        CHECK(DecimateLTTB(sample, 5, 8, index, value) == 5);
+        CHECK(value[4] == 8.0f);
+        CHECK(DecimateMinMax(sample, 3, 8, index, value) == 3);
+    }
+
+    SUBCASE("Ring Buffer Sampler") {
+        // Logical order starts at offset 3 of a 6-element ring with a 2-float stride
+        float ring[12] = { 3, 0, 4, 0, 5, 0, 0, 0, 1, 0, 2, 0 };
+        const int offset = 3, count = 6, stride = 2;
+        auto sample = [&](int i) {
+            int idx = offset + i;
+            if (idx >= count) idx -= count;
+            return ring[idx * stride];
+        };
+        float index[6], value[6];
+        int n = DecimateLTTB(sample, count, 6, index, value);
+        REQUIRE(n == 6);
+        for (int i = 0; i < n; ++i)
+            CHECK(value[i] == (float)i);
+    }
+}
+
+// =============================================
+// Streaming Series Tests (pure container, no ImGui context)
+// =============================================
+
+#include "EFIGUI/Core/Series.h"
+
+TEST_CASE("Streaming Series") {
+    using namespace EFIGUI;
+
+    SUBCASE("Min Max Kernel") {
+        float values[37];
+        for (int i = 0; i < 37; ++i)
+            values[i] = (float)((i * 17) % 37) - 10.0f;
+        float lo = FLT_MAX, hi = -FLT_MAX;
+        AccumulateMinMax(values, 37, lo, hi);
+        CHECK(lo == -10.0f);
+        CHECK(hi == 26.0f);
+
+        lo = FLT_MAX; hi = -FLT_MAX;
+        AccumulateMinMax(values, 3, lo, hi);
+        CHECK(lo == -10.0f);
+        CHECK(hi == 24.0f);
+    }
+
+    SUBCASE("Fills Then Wraps") {
+        StreamingSeries series(4);
+        CHECK(series.Empty());
+        series.Push(1.0f);
+        series.Push(2.0f);
+        CHECK(series.Size() == 2);
+        CHECK(series.Offset() == 0);
+        series.Push(3.0f);
+        series.Push(4.0f);
+        series.Push(5.0f);
+        CHECK(series.Size() == 4);
+        CHECK(series.Offset() == 1);
+        CHECK(series[0] == 2.0f);
+        CHECK(series[3] == 5.0f);
+        CHECK(series.Back() == 5.0f);
+        CHECK(series.Data()[0] == 5.0f);
+    }
+
+    SUBCASE("Running Extrema Match A Rescan") {
+        StreamingSeries series(50);
+        uint32_t rng = 12345;
+        for (int step = 0; step < 1000; ++step) {
+            rng = rng * 1664525u + 1013904223u;
+            series.Push((float)((rng >> 8) % 2001) - 1000.0f);
+
+            float lo = FLT_MAX, hi = -FLT_MAX;
+            for (int i = 0; i < series.Size(); ++i) {
+                lo = series[i] < lo ? series[i] : lo;
+                hi = series[i] > hi ? series[i] : hi;
+            }
+            REQUIRE(series.Min() == lo);
+            REQUIRE(series.Max() == hi);
+        }
+    }
+
+    SUBCASE("Reset Changes Capacity") {
+        StreamingSeries series(3);
+        series.Push(7.0f);
+        series.Reset(8);
+        CHECK(series.Empty());
+        CHECK(series.Capacity() == 8);
+        CHECK(series.Min() == FLT_MAX);
+    }
+}
+
+TEST_CASE("Scrolling Series") {
+    using namespace EFIGUI;
+
+    SUBCASE("Spans Unwrap Oldest First") {
+        ScrollingSeries<int> series(5);
+        for (int v = 1; v <= 3; ++v)
+            series.Push(v);
+        SeriesSpans<int> spans = series.GetSpans();
+        CHECK(spans.firstCount == 3);
+        CHECK(spans.secondCount == 0);
+
+        for (int v = 4; v <= 7; ++v)
+            series.Push(v);
+        spans = series.GetSpans();
+        REQUIRE(spans.Size() == 5);
+        int expected = 3;
+        for (int i = 0; i < spans.firstCount; ++i)
+            CHECK(spans.first[i] == expected++);
+        for (int i = 0; i < spans.secondCount; ++i)
+            CHECK(spans.second[i] == expected++);
+        CHECK(expected == 8);
+        CHECK(series.Min() == 3);
+        CHECK(series.Max() == 7);
+    }
+
+    SUBCASE("Timestamps Follow Samples") {
+        ScrollingSeries<double> series(3, true);
+        REQUIRE(series.HasTimestamps());
+        for (int i = 0; i < 5; ++i)
+            series.Push(i * 0.5, i * 10.0);
+        CHECK(series.GetTime(0) == 1.0);
+        CHECK(series[0] == 20.0);
+        SeriesSpans<double> times = series.GetTimeSpans();
+        CHECK(times.Size() == 3);
+        CHECK(times.first[0] == 1.0);
+
+        ScrollingSeries<float> plain(3);
+        plain.Push(1.0, 2.0f);
+        CHECK_FALSE(plain.HasTimestamps());
+        CHECK(plain.GetTimeSpans().Size() == 0);
+        CHECK(plain.Back() == 2.0f);
+    }
+}
+
+// ============================================
+// Chunked Series Source Tests
+// ============================================
+
+namespace {
+    struct CountingSource {
+        std::vector<float> values;
+        int calls = 0;
+    };
+
+    void FillCounting(void* data, int start, int count, float* out) {
+        auto& source = *static_cast<CountingSource*>(data);
+        source.calls++;
+        for (int i = 0; i < count; ++i)
+            out[i] = source.values[start + i];
+    }
+}
+
+TEST_CASE("Chunked Series Source") {
+    using namespace EFIGUI;
+
+    SUBCASE("Typed Strided Fill") {
+        struct Sample { int64_t time; uint16_t value; };
+        Sample samples[4] = { {10, 1}, {20, 65535}, {30, 7}, {40, 0} };
+        StridedSource values{ &samples[0].value, (int)sizeof(Sample) };
+        float out[3];
+        FillStrided<uint16_t>(&values, 1, 3, out);
+        CHECK(out[0] == 65535.0f);
+        CHECK(out[1] == 7.0f);
+        CHECK(out[2] == 0.0f);
+
+        StridedSource times{ &samples[0].time, (int)sizeof(Sample) };
+        FillStrided<int64_t>(&times, 0, 2, out);
+        CHECK(out[0] == 10.0f);
+        CHECK(out[1] == 20.0f);
+
+        double dense[3] = { 0.5, -1.5, 2.0 };
+        StridedSource packed{ dense, (int)sizeof(double) };
+        FillStrided<double>(&packed, 0, 3, out);
+        CHECK(out[1] == -1.5f);
+    }
+
+    SUBCASE("Ring Read Splits At The Wrap") {
+        CountingSource source;
+        source.values = { 0, 1, 2, 3, 4 };
+        float out[5];
+        ReadSeries(&FillCounting, &source, 5, 3, 0, 5, out);
+        CHECK(source.calls == 2);
+        const float expected[5] = { 3, 4, 0, 1, 2 };
+        for (int i = 0; i < 5; ++i)
+            CHECK(out[i] == expected[i]);
+
+        source.calls = 0;
+        ReadSeries(&FillCounting, &source, 5, 3, 2, 2, out);
+        CHECK(source.calls == 1);
+        CHECK(out[0] == 0.0f);
+        CHECK(out[1] == 1.0f);
+    }
+
+    SUBCASE("Reader Pulls Each Sample Once For A Min/Max Pass") {
+        const int count = 5000;
+        CountingSource source;
+        source.values.resize(count);
+        for (int i = 0; i < count; ++i)
+            source.values[i] = std::sin(i * 0.01f) * 10.0f + (i == 1234 ? 50.0f : 0.0f);
+
+        ChunkedReader reader(&FillCounting, &source, count, 0);
+        std::vector<float> idxA(200), valA(200), idxB(200), valB(200);
+        int a = DecimateMinMax([&](int i) { return reader(i); }, count, 100, idxA.data(), valA.data());
+        int b = DecimateMinMax([&](int i) { return source.values[i]; }, count, 100, idxB.data(), valB.data());
+        REQUIRE(a == b);
+        for (int i = 0; i < a; ++i) {
+            CHECK(idxA[i] == idxB[i]);
+            CHECK(valA[i] == valB[i]);
+        }
+        CHECK(reader.GetReadCount() == count);
+
+        // The pass also collected the series range
+        REQUIRE(reader.HasReadAll());
+        const auto extrema = std::minmax_element(source.values.begin(), source.values.end());
+        CHECK(reader.GetMin() == *extrema.first);
+        CHECK(reader.GetMax() == *extrema.second);
+    }
+
+    SUBCASE("Reader Matches Direct LTTB Through An Offset") {
+        const int count = 3000, offset = 1700;
+        CountingSource source;
+        source.values.resize(count);
+        for (int i = 0; i < count; ++i)
+            source.values[i] = std::cos(i * 0.02f) * (i % 7);
+
+        auto direct = [&](int i) { return source.values[(offset + i) % count]; };
+
+        // Buckets of ~49 and ~500 samples (the latter wider than a chunk);
+        // the look-ahead spans two of them
+        for (int threshold : { 64, 8 }) {
+            CAPTURE(threshold);
+            const int bucket = (count - 2) / (threshold - 2) + 1;
+            std::vector<ChunkedReader::Chunk> cache(ChunkedReader::CacheChunksForSpan(bucket * 2 + 1));
+            ChunkedReader reader(&FillCounting, &source, count, offset, cache.data(), (int)cache.size());
+            std::vector<float> idxA(threshold), valA(threshold), idxC(threshold), valC(threshold);
+            int a = DecimateLTTB([&](int i) { return reader(i); }, count, threshold, idxA.data(), valA.data());
+            int c = DecimateLTTB(direct, count, threshold, idxC.data(), valC.data());
+            REQUIRE(a == c);
+            for (int i = 0; i < a; ++i)
+                CHECK(valA[i] == valC[i]);
+
+            // Each sample converted once, and the range comes with it
+            CHECK(reader.GetReadCount() == count);
+            CHECK(reader.HasReadAll());
+            CHECK(reader.GetMin() == *std::min_element(source.values.begin(), source.values.end()));
+            CHECK(reader.GetMax() == *std::max_element(source.values.begin(), source.values.end()));
+        }
+    }
+
+    SUBCASE("Partial Reads Do Not Report A Range") {
+        CountingSource source;
+        source.values.resize(2000, 1.0f);
+        ChunkedReader reader(&FillCounting, &source, 2000, 0);
+        reader(0);
+        reader(1500);
+        CHECK(reader.GetReadCount() == ChunkedReader::ChunkSize * 2);
+        CHECK_FALSE(reader.HasReadAll());
+    }
+}
+
+// ============================================
+// Layer Command Payload Tests (no ImGui context)
+// ============================================
+
+#include "EFIGUI/Core/Layer.h"
+
+TEST_CASE("Layer Command Payloads") {
+    using namespace EFIGUI;
+
+    // Double-buffered mode: a worker recording's arena is reset and reused by
+    // the next BeginFrame while the sealed frame that merged it is replayed
+    SUBCASE("Merged Worker Payloads Outlive The Worker Arena") {
+        FrameArena worker(256);
+        FrameArena sealed(256);
+
+        DeferredDrawCommand text;
+        text.type = DrawCommandType::Text;
+        text.data.text = { ImVec2(1.0f, 2.0f), nullptr, 0.0f, worker.CopyString("worker label") };
+
+        const ImVec2 points[3] = { ImVec2(0, 0), ImVec2(10, 5), ImVec2(20, 0) };
+        const ImU32 colors[3] = { 0xFF0000FFu, 0xFF00FF00u, 0xFFFF0000u };
+        ImVec2* workerPoints = worker.AllocateArray<ImVec2>(3);
+        ImU32* workerColors = worker.AllocateArray<ImU32>(3);
+        std::memcpy(workerPoints, points, sizeof(points));
+        std::memcpy(workerColors, colors, sizeof(colors));
+
+        DeferredDrawCommand line;
+        line.type = DrawCommandType::Polyline;
+        line.data.polyline = { workerPoints, workerColors, 3, 2.0f, false };
+
+        DeferredDrawCommand rect;
+        rect.type = DrawCommandType::RectFilled;
+        rect.data.rect = { ImVec2(0, 0), ImVec2(4, 4), 0.0f, 0.0f, 0 };
+
+        CopyCommandPayload(text, sealed);
+        CopyCommandPayload(line, sealed);
+        CopyCommandPayload(rect, sealed);
+
+        // Next frame: the worker arena is recycled and overwritten
+        worker.Reset();
+        std::memset(worker.AllocateArray<char>(256), 0x7F, 256);
+
+        CHECK(std::strcmp(text.data.text.text, "worker label") == 0);
+        CHECK(line.data.polyline.points != workerPoints);
+        for (int i = 0; i < 3; ++i) {
+            CHECK(line.data.polyline.points[i].x == points[i].x);
+            CHECK(line.data.polyline.points[i].y == points[i].y);
+            CHECK(line.data.polyline.colors[i] == colors[i]);
+        }
+        CHECK(rect.data.rect.max.x == 4.0f);
+    }
+
+    SUBCASE("Single Color Polyline Keeps Null Colors") {
+        FrameArena source(128);
+        FrameArena target(128);
+        ImVec2* points = source.AllocateArray<ImVec2>(2);
+        points[0] = ImVec2(1, 1);
+        points[1] = ImVec2(2, 2);
+
+        DeferredDrawCommand line;
+        line.type = DrawCommandType::Polyline;
+        line.data.polyline = { points, nullptr, 2, 1.0f, false };
+        CopyCommandPayload(line, target);
+        CHECK(line.data.polyline.colors == nullptr);
+        CHECK(line.data.polyline.points[1].x == 2.0f);
+    }
+}
+
+// ============================================
+// Animation Clock Tests (no ImGui context)
+// ============================================
+
+#include "EFIGUI/Core/AnimationClock.h"
+
+TEST_CASE("Animation Clock") {
+    using namespace EFIGUI::Animation;
+
+    SUBCASE("Two Contexts Switched Within A Frame Step Once") {
+        Clock a, b;
+        a.source = b.source = TimeSource::FixedStep;
+        a.fixedStep = 0.5f;
+        b.fixedStep = 0.25f;
+
+        // Frame 1: the host renders A, then B, then A again
+        CHECK(a.Tick(1, 0.0, 0.0f));
+        CHECK(b.Tick(1, 0.0, 0.0f));
+        CHECK_FALSE(a.Tick(1, 0.0, 0.0f));
+        CHECK(a.time == 0.0);
+        CHECK(a.dt == 0.5f);
+
+        // Frame 2 (each context keeps its own frame count)
+        CHECK(a.Tick(2, 0.0, 0.0f));
+        CHECK(b.Tick(2, 0.0, 0.0f));
+        CHECK_FALSE(b.Tick(2, 0.0, 0.0f));
+        CHECK_FALSE(a.Tick(2, 0.0, 0.0f));
+        CHECK(a.time == 0.5);
+        CHECK(b.time == 0.25);
+    }
+
+    SUBCASE("Manual Step Survives A Repeated Tick") {
+        Clock clock;
+        clock.source = TimeSource::Manual;
+        clock.pendingAdvance = 0.1;
+        clock.Tick(7, 0.0, 0.0f);
+        clock.Tick(7, 0.0, 0.0f);
+        CHECK(clock.dt == doctest::Approx(0.1f));
+        CHECK(clock.time == doctest::Approx(0.1));
+
+        // The next frame without AdvanceClock has no time step
+        clock.Tick(8, 0.0, 0.0f);
+        CHECK(clock.dt == 0.0f);
+        CHECK(clock.time == doctest::Approx(0.1));
+    }
+
+    SUBCASE("Real Source Follows The Host Clock") {
+        Clock clock;
+        clock.Tick(3, 12.5, 0.016f);
+        CHECK(clock.time == 12.5);
+        CHECK(clock.dt == 0.016f);
+    }
+}
+
+// ============================================
+// Tween Pool Tests (no ImGui context)
+// ============================================
+
+#include "EFIGUI/Core/Timeline.h"
+
+TEST_CASE("Tween Pool") {
+    using namespace EFIGUI::Animation;
+
+    SUBCASE("Keyframes And Easing") {
+        CHECK(ApplyEase(Ease::Linear, 0.5f) == 0.5f);
+        CHECK(ApplyEase(Ease::InQuad, 0.5f) == doctest::Approx(0.25f));
+        CHECK(ApplyEase(Ease::OutQuad, 0.5f) == doctest::Approx(0.75f));
+        CHECK(ApplyEase(Ease::OutBack, 1.0f) == doctest::Approx(1.0f));
+        CHECK(ApplyEase(Ease::OutElastic, 1.0f) == doctest::Approx(1.0f));
+
+        TweenPool pool;
+        TweenHandle h = pool.Play(FloatTrack().Key(0.0f, 0.0f).Key(1.0f, 10.0f, Ease::InQuad).Key(2.0f, 20.0f));
+        CHECK(pool.GetFloat(h) == 0.0f);
+
+        pool.Update(0.5f);
+        CHECK(pool.GetFloat(h) == doctest::Approx(2.5f));
+
+        // Second segment is linear
+        pool.Update(1.0f);
+        CHECK(pool.GetFloat(h) == doctest::Approx(15.0f));
+        CHECK(pool.IsPlaying(h));
+
+        // Past the last key: hold it and finish
+        pool.Update(1.0f);
+        CHECK(pool.GetFloat(h) == 20.0f);
+        CHECK_FALSE(pool.IsPlaying(h));
+
+        TweenHandle c = pool.Play(ColorTrack().Key(0.0f, IM_COL32(0, 0, 0, 0)).Key(1.0f, IM_COL32(200, 100, 50, 255)));
+        pool.Update(0.5f);
+        CHECK(pool.GetColor(c) == IM_COL32(100, 50, 25, 128));
+    }
+
+    SUBCASE("Loop Wraps") {
+        TweenPool pool;
+        TweenHandle h = pool.Play(FloatTrack().Key(0.0f, 0.0f).Key(1.0f, 10.0f).Loop());
+
+        pool.Update(1.25f);
+        CHECK(pool.GetFloat(h) == doctest::Approx(2.5f));
+        pool.Update(0.5f);
+        CHECK(pool.GetFloat(h) == doctest::Approx(7.5f));
+        pool.Update(0.5f);
+        CHECK(pool.GetFloat(h) == doctest::Approx(2.5f));
+        CHECK(pool.IsPlaying(h));
+    }
+
+    SUBCASE("Stagger Offsets") {
+        TweenPool pool;
+        TweenHandle h[3];
+        pool.Stagger(FloatTrack().Key(0.0f, 0.0f).Key(1.0f, 1.0f).Delay(0.1f), 3, 0.5f, h);
+        CHECK(pool.GetCount() == 3);
+
+        pool.Update(0.6f);
+        CHECK(pool.GetFloat(h[0]) == doctest::Approx(0.5f));
+        CHECK(pool.GetFloat(h[1]) == doctest::Approx(0.0f));
+        CHECK(pool.GetFloat(h[2]) == 0.0f);
+
+        pool.Update(0.5f);
+        CHECK(pool.GetFloat(h[0]) == 1.0f);
+        CHECK(pool.GetFloat(h[1]) == doctest::Approx(0.5f));
+        CHECK(pool.GetFloat(h[2]) == doctest::Approx(0.0f));
+    }
+
+    SUBCASE("Stale Handle Falls Back After Reclaim") {
+        TweenPool pool;
+        TweenHandle h = pool.Play(FloatTrack().Key(0.0f, 0.0f).Key(0.5f, 1.0f));
+
+        pool.Update(1.0f);
+        CHECK(pool.GetFloat(h, -1.0f) == 1.0f);
+
+        // Read during the last update: kept
+        pool.Update(0.0f);
+        CHECK(pool.GetCount() == 1);
+
+        // Not read for an update: reclaimed
+        pool.Update(0.0f);
+        CHECK(pool.GetCount() == 0);
+        CHECK(pool.GetFloat(h, -1.0f) == -1.0f);
+        CHECK_FALSE(pool.IsPlaying(h));
+
+        CHECK(pool.GetFloat(TweenHandle{}, -2.0f) == -2.0f);
+    }
+
+    SUBCASE("Slots Are Reused With A New Generation") {
+        TweenPool pool;
+        TweenHandle first = pool.Play(FloatTrack().Key(0.0f, 1.0f).Key(1.0f, 2.0f));
+        pool.Stop(first);
+        CHECK(pool.GetCount() == 0);
+
+        TweenHandle second = pool.Play(FloatTrack().Key(0.0f, 5.0f).Key(1.0f, 6.0f));
+        CHECK(second.index == first.index);
+        CHECK(second.generation != first.generation);
+        CHECK(pool.GetCapacity() == 1);
+        CHECK(pool.GetFloat(first, -1.0f) == -1.0f);
+        CHECK(pool.GetFloat(second) == 5.0f);
+
+        // Stopping through the stale handle leaves the new track alone
+        pool.Stop(first);
+        CHECK(pool.GetCount() == 1);
+
+        pool.Clear();
+        CHECK(pool.GetCount() == 0);
+        CHECK(pool.GetCapacity() == 1);
+    }
+}
+
+// ============================================
+// Spring Step Tests (no ImGui context)
+// ============================================
+
+#include "EFIGUI/Core/AnimationSpring.h"
+#include <algorithm>
+
+namespace {
+    void ApplySpringStep(const EFIGUI::Animation::SpringStep& step, float& x, float& v) {
+        float nx = step.a * x + step.b * v;
+        float nv = step.c * x + step.d * v;
+        x = nx;
+        v = nv;
+    }
+}
+
+TEST_CASE("Spring Step") {
+    using namespace EFIGUI::Animation;
+
+    SUBCASE("Same Motion At 30 And 240 FPS") {
+        for (float damping : { 1.0f, 0.5f, 0.2f }) {
+            CAPTURE(damping);
+            float x30 = 1.0f, v30 = 0.0f;
+            float x240 = 1.0f, v240 = 0.0f;
+            SpringStep slow = ComputeSpringStep(4.0f, damping, 1.0f / 30.0f);
+            SpringStep fast = ComputeSpringStep(4.0f, damping, 1.0f / 240.0f);
+
+            // 0.5 s of motion: 15 frames at 30 fps vs 120 at 240 fps
+            for (int frame = 0; frame < 15; frame++) {
+                ApplySpringStep(slow, x30, v30);
+                for (int sub = 0; sub < 8; sub++)
+                    ApplySpringStep(fast, x240, v240);
+                CHECK(x30 == doctest::Approx(x240).epsilon(1e-3).scale(1.0));
+                CHECK(v30 == doctest::Approx(v240).epsilon(1e-3).scale(25.0));
+            }
+        }
+    }
+
+    SUBCASE("Under-Damped Overshoots, Critical Does Not") {
+        float xc = 1.0f, vc = 0.0f, xu = 1.0f, vu = 0.0f;
+        float minCritical = 1.0f, minUnder = 1.0f;
+        SpringStep critical = ComputeSpringStep(4.0f, 1.0f, 1.0f / 60.0f);
+        SpringStep under = ComputeSpringStep(4.0f, 0.3f, 1.0f / 60.0f);
+        for (int frame = 0; frame < 60; frame++) {
+            ApplySpringStep(critical, xc, vc);
+            ApplySpringStep(under, xu, vu);
+            minCritical = std::min(minCritical, xc);
+            minUnder = std::min(minUnder, xu);
+        }
+        CHECK(minCritical >= 0.0f);
+        CHECK(minUnder < -0.1f);
+    }
+
+    SUBCASE("Zero Time Step Is Identity") {
+        SpringStep step = ComputeSpringStep(4.0f, 1.0f, 0.0f);
+        CHECK(step.a == 1.0f);
+        CHECK(step.b == 0.0f);
+        CHECK(step.c == 0.0f);
+        CHECK(step.d == 1.0f);
+    }
+
+    SUBCASE("Batch Records A Channel Once Per Frame") {
+        SpringBatch batch;
+        SpringChannel first, second;
+        SpringStep slow = ComputeSpringStep(2.0f, 1.0f, 1.0f / 60.0f);
+        SpringStep fast = ComputeSpringStep(8.0f, 1.0f, 1.0f / 60.0f);
+
+        batch.Record(first, slow);
+        batch.Record(second, slow);
+        batch.Record(first, fast);
+        CHECK(batch.channels.size() == 2);
+        CHECK(batch.a.size() == 2);
+        CHECK(batch.channels[0] == &first);
+        CHECK(batch.a[0] == fast.a);
+        CHECK(batch.a[1] == slow.a);
+
+        // Next frame: stale lanes from the cleared batch are not reused
+        batch.Clear();
+        batch.Record(second, fast);
+        batch.Record(first, fast);
+        batch.Record(second, slow);
+        CHECK(batch.channels.size() == 2);
+        CHECK(batch.channels[0] == &second);
+        CHECK(batch.channels[1] == &first);
+        CHECK(batch.b[0] == slow.b);
+    }
+}